@@ -5,6 +5,20 @@ if ("${CMAKE_SYSTEM_NAME}" MATCHES "Linux")
 set (
 		NINA_SRC_FILES
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaPacket.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaGatherPacket.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaCRC32C.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTimerQueue.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaIdleWheel.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSocketProfile.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddrList.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddrKey.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaNetTables.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaResolver.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTSCClock.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaUnixAddr.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaUnixStream.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaUnixDatagram.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaUnixAcceptor.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaAddr.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddr.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaIOContainer.cpp
@@ -16,6 +30,9 @@ set (
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockIO.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockStream.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockDatagram.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaDatagramBatch.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaDatagramHandler.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaLatencyHistogram.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockAcceptor.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockConnector.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTime.cpp
@@ -25,7 +42,7 @@ set (
 
 
 if (LINUX_PREREQUISITE)
-target_link_libraries (nina rt)
+target_link_libraries (nina rt pthread)
 endif()
 
 # Compiling informations
@@ -5,6 +5,20 @@ if ("${CMAKE_SYSTEM_NAME}" MATCHES ".*BSD")
 set (
 		NINA_SRC_FILES
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaPacket.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaGatherPacket.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaCRC32C.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTimerQueue.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaIdleWheel.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSocketProfile.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddrList.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddrKey.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaNetTables.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaResolver.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTSCClock.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaUnixAddr.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaUnixStream.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaUnixDatagram.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaUnixAcceptor.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaAddr.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddr.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaIOContainer.cpp
@@ -16,6 +30,9 @@ set (
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockIO.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockStream.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockDatagram.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaDatagramBatch.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaDatagramHandler.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaLatencyHistogram.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockAcceptor.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockConnector.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTime.cpp
@@ -25,9 +42,9 @@ set (
 
 # Compiling informations
 
-set (CMAKE_CXX_FLAGS "-W -Wextra -ansi -Wall")
-set (CMAKE_CXX_FLAGS_DEBUG "-W -Wall -Wextra -ansi -g3")
-set (CMAKE_CXX_FLAGS_RELEASE "-W -Wextra -ansi -Wno-strict-aliasing -O2 -Wall")
+set (CMAKE_CXX_FLAGS "-pthread -W -Wextra -ansi -Wall")
+set (CMAKE_CXX_FLAGS_DEBUG "-pthread -W -Wall -Wextra -ansi -g3")
+set (CMAKE_CXX_FLAGS_RELEASE "-pthread -W -Wextra -ansi -Wno-strict-aliasing -O2 -Wall")
 
 # Install settings
 
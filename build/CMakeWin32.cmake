@@ -5,6 +5,15 @@ if (WIN32)
 set (
 		NINA_SRC_FILES
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaPacket.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaGatherPacket.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaCRC32C.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTimerQueue.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaIdleWheel.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSocketProfile.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddrList.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddrKey.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaNetTables.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTSCClock.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaAddr.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaInetAddr.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaIOContainer.cpp
@@ -16,6 +25,9 @@ set (
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockIO.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockStream.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockDatagram.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaDatagramBatch.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaDatagramHandler.cpp
+		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaLatencyHistogram.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockAcceptor.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaSockConnector.cpp
 		${CMAKE_CURRENT_SOURCE_DIR}/../src/NinaTime.cpp
@@ -22,11 +22,8 @@ class EchoReply : public NINA::ServiceHandler<>
 		enum { BUFSIZE = 1023 };
 
 	public:
-		EchoReply() {}
-		~EchoReply()
-		{
-			 NINA::Reactor<POLICY>::getSingleton().removeHandler(this, NINA::Events::ALL);
-		}
+		EchoReply() : mSize(0) {}
+		~EchoReply() {}
 
 	public:
 		int init()
@@ -41,7 +38,8 @@ class EchoReply : public NINA::ServiceHandler<>
 			mSize  = getPeer().receive(mBuf, BUFSIZE);
 			if (mSize == 0) {
 				std::cout << "Client " << getRemoteAddr().getHostAddr() << " disconnected" << std::endl;
-				delete this;
+				NINA::Reactor<POLICY>::getSingleton().removeHandler(this, NINA::Events::ALL);
+				destroy();
 				return 1;
 			}
 			else {
@@ -52,6 +50,11 @@ class EchoReply : public NINA::ServiceHandler<>
 			return 0;
 		}
 
+		void reset()
+		{
+			mSize = 0;
+		}
+
 		int handleWrite(NINA::NINAHandle)
 		{
 			std::cout << "Sending reply ..." << std::endl;
@@ -70,7 +73,8 @@ int main(void)
 {
 	NINA::Reactor<POLICY>									reactor;
 	NINA::InetAddr											local_address;
-	NINA::Acceptor<EchoReply, NINA::SockAcceptor, POLICY>	acceptor(&reactor);
+	NINA::Acceptor<EchoReply, NINA::SockAcceptor, POLICY, true,
+		NINA::RecycleAllocator<EchoReply> >					acceptor(&reactor);
 
 	NINA::Init						startup;
 
@@ -25,9 +25,11 @@
 # include "NinaDef.hpp"
 # include "NinaEventHandler.hpp"
 # include "NinaSockAcceptor.hpp"
+# include "NinaSockDatagram.hpp"
 # include "NinaReactor.hpp"
 # include "NinaSystemError.hpp"
 # include "NinaSAP.hpp"
+# include "NinaServiceAllocator.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
 
@@ -35,21 +37,31 @@ NINA_BEGIN_NAMESPACE_DECL
  * @brief Accept incoming connections and start the appropriate service
  *
  * @details This class accepts all incoming connections then calls the SVC_HANDLER::init function<br/>
- * It permits a separation between connection process and the services provided by the application
+ * It permits a separation between connection process and the services provided by the application<br/>
+ * The Acceptor protects itself against overloads: once a limit is reached (see Acceptor::setMaxConnections,
+ * Acceptor::setMaxResidentSize and Acceptor::setMaxLoopLag) it suspends itself, then resumes once the limits are
+ * respected again. When the handles are exhausted (EMFILE/ENFILE), a reserved handle is released to accept and
+ * close the pending connection rather than spinning on the listening handle, then the Acceptor suspends itself
  * @arg SVC_HANDLER : service launched at the acceptance (see NINA::ServiceHandler)
  * @arg IPC_ACCEPTOR : underlying IPC class used by the Acceptor
  * @arg SYNC_POLICY : policy used by the dispatcher (see NINA::Reactor)
+ * @arg ALLOCATOR : allocator of the SVC_HANDLER (see NINA::NewAllocator, NINA::RecycleAllocator)
  * @throw NINA::Error::SystemError if THROW_ON_ERR is true and an error occured while accepting
  * (note that if an exception occured, it will be thrown during the event loop see: Reactor::handleEvents)
  */ 
 template <class SVC_HANDLER, class IPC_ACCEPTOR = SockAcceptor,
-		 class SYNC_POLICY = NINADefaultPolicy, bool THROW_ON_ERR = true>
+		 class SYNC_POLICY = NINADefaultPolicy, bool THROW_ON_ERR = true,
+		 class ALLOCATOR = NewAllocator<SVC_HANDLER> >
 class Acceptor : public EventHandler
 {
 	public:
 		//! Adress class associated with the IPC_ACCEPTOR<br/>
 		//! Note that the name _Addr isn't trivial, in fact all address classes descend from NINA::Addr
 		typedef typename IPC_ACCEPTOR::PeerAddr _Addr;
+		//! Default number of connections accepted per read event (see Acceptor::setAcceptBatch)
+		enum { DEFAULT_ACCEPT_BATCH = 64 };
+		//! Default interval between two checks of the limits in microseconds (see Acceptor::setOverloadCheck)
+		enum { DEFAULT_OVERLOAD_CHECK = 100000 };
 
 	public:
 		/*! @brief Constructor
@@ -66,7 +78,11 @@ class Acceptor : public EventHandler
 		Acceptor& operator=(Acceptor const& acceptor);
 
 	public:
-		//! @brief Handle read events on the underlying socket
+		/*!
+		 * @brief Handle read events on the underlying socket
+		 * @details If the IPC_ACCEPTOR is non blocking, pending connections are accepted until the
+		 * backlog is drained or the accept batch is reached (see Acceptor::setAcceptBatch)
+		 */
 		virtual int handleRead(NINAHandle handle);
 		//! @brief Handle write events on the underlying socket
 		virtual int handleWrite(NINAHandle) {return 0;};
@@ -79,6 +95,10 @@ class Acceptor : public EventHandler
 		//! @brief Handle close events on the underlying socket
 		//! @throw NINA::Error::SystemError if THROW_ON_ERR is true
 		virtual int handleClose(NINAHandle handle);
+		//! @brief Handle the overload check timer, resuming the Acceptor once the limits are respected
+		virtual int handleTimer(long timerId);
+		//! @brief Handle the start of a drain, the acceptation of connections is suspended (see Reactor::drain)
+		virtual int handleDrain(NINAHandle);
 		//! @brief Get the underlying handle to process double dispatching
 		virtual NINAHandle getHandle() const;
 		/*!
@@ -89,11 +109,30 @@ class Acceptor : public EventHandler
 		 * @param[in] protocol : protocol used by the IPC_ACCEPTOR
 		 * @param[in] reuseAddr : specify if the binding will be reusable before the 2MSL
 		 * @param[in] backlog : specify the backlog used by the Acceptor (length of the pending connections queue)
+		 * @param[in] reusePort : allow other Acceptors to listen on the same address (SO_REUSEPORT)<br/>
+		 * Opening one Acceptor per reactor thread this way shards the incoming connections between the threads,
+		 * each of them accepting and serving its own connections<br/>
+		 * The reserved handle used on handles exhaustion is also opened there
+		 * @param[in] profile : TCP options of the Acceptor and its SVC_HANDLER peers, the options inherited from the
+		 * listening handle are only set once (see SocketProfile)
 		 * @return 0 on success or -1 on error<br/>
 		 * If an error occured errno will be set accordingly
 		 */
 		virtual int open(_Addr const& addr, bool sockNonBlock = false, int family = PF_UNSPEC,
-				int protocol = IPC_ACCEPTOR::ANY_PROTO, bool reuseAddr = false, int backlog = SOMAXCONN);
+				int protocol = IPC_ACCEPTOR::ANY_PROTO, bool reuseAddr = false, int backlog = SOMAXCONN,
+				bool reusePort = false, SocketProfile const* profile = 0);
+		/*!
+		 * @brief Initialize the Acceptor with a handle which is already listening
+		 * @details This is the other end of a hot restart: the listening handles of the previous process are
+		 * received over a unix domain socket (see UnixStream::receiveHandles) then adopted, thus the address is
+		 * never unbound and the pending connections are kept. The previous process only has to close its copy
+		 * @param[in] handle : the listening handle, owned by the Acceptor on success, left untouched to the caller on error
+		 * @param[in] sockNonBlock : set the IPC_ACCEPTOR in non blocking mode
+		 * @param[in] profile : options of the SVC_HANDLER peers, the listening handle keeps its own ones
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		virtual int adopt(NINAHandle handle, bool sockNonBlock = false, SocketProfile const* profile = 0);
 		/*!
 		 * @brief Accept an incoming connection and initialize the SVC_HANDLER if it succeed
 		 * @return 0 on success or -1 on error<br/>
@@ -113,17 +152,99 @@ class Acceptor : public EventHandler
 		 * If an error occured errno will be set accordingly
 		 */
 		virtual int resume();	
+		/*!
+		 * @brief Set the maximum number of connections accepted per read event
+		 * @details A batch only applies to a non blocking IPC_ACCEPTOR, a blocking one accepts a single connection
+		 * @param[in] batch : the maximum number of connections (at least one)
+		 */
+		void setAcceptBatch(size_t batch);
+		/*!
+		 * @brief Set the options inherited by the accepted SVC_HANDLER peers
+		 * @param[in] flags : a bit set composed of SAP::NON_BLOCK/SAP::CLOSE_ON_EXEC (see SockAcceptor::accept)
+		 */
+		void setHandlerFlags(uint8_t flags);
+		/*!
+		 * @brief Steer the connections of a reuse port group according to the receiving CPU (see SockAcceptor::steerByCPU)
+		 * @param[in] groupSize : number of Acceptors sharing the address
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int steerByCPU(unsigned int groupSize);
+		/*!
+		 * @brief Get the address the Acceptor is listening on
+		 * @param[out] addr : the local address
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int getLocalAddr(_Addr& addr) const;
+		//! @brief Get the allocator of the SVC_HANDLER (to retrieve its statistics or tune it)
+		ALLOCATOR& getAllocator();
+		/*!
+		 * @brief Set the maximum number of connections
+		 * @details The connections are the SVC_HANDLER initialized by the Acceptor which are not destroyed yet
+		 * (see ServiceHandler::destroy), the other handles of the reactor are not counted
+		 * @param[in] max : the maximum number of connections, 0 for no limit (default)
+		 */
+		void setMaxConnections(size_t max);
+		/*!
+		 * @brief Set the maximum resident memory of the process (see OS::getResidentSize)
+		 * @details The memory is sampled at most once per overload check interval
+		 * @param[in] max : the maximum size in bytes, 0 for no limit (default)
+		 */
+		void setMaxResidentSize(size_t max);
+		/*!
+		 * @brief Set the maximum lag of the reactor loop (see Reactor::getLoopLag)
+		 * @details Setting a limit enables the measure of the lag by the reactor
+		 * @param[in] max : the maximum lag, Time::timeNull for no limit (default)
+		 */
+		void setMaxLoopLag(Time const& max);
+		//! @brief Set the interval between two checks of the limits while the Acceptor is overloaded
+		void setOverloadCheck(Time const& interval);
+		//! @brief Check whether the Acceptor is suspended because of an overload
+		bool isOverloaded() const;
+		//! @brief Get the number of connections closed right after their acceptance because the handles were exhausted
+		unsigned long getRejectedCount() const;
+		//! @brief Get the number of times the Acceptor suspended itself because of an overload
+		unsigned long getOverloadCount() const;
+		//! @brief Get the number of connections, namely the live SVC_HANDLER (see setMaxConnections)
+		size_t getConnectionCount() const;
+
 	protected:
-		//! @brief SVC_HANDLER factory method
+		//! @brief SVC_HANDLER factory method (see ALLOCATOR)
 		virtual SVC_HANDLER* makeServiceHandler() const;
 		//! @brief Accept a connection and set the SVC_HANDLER handle
 		virtual int acceptServiceHandler(SVC_HANDLER* serviceHandler);
 		//! @brief Initialize the SVC_HANDLER
 		virtual int initServiceHandler(SVC_HANDLER* serviceHandler) const;
+		//! @brief Check whether a limit is exceeded, it may be overriden to provide other limits
+		virtual bool checkOverload();
+
+	private:
+		//! @brief Suspend the Acceptor until the limits are respected
+		//! @return 1 as its events are removed (see EventHandler::handleRead)
+		int throttle();
+		//! @brief Accept and close a pending connection using the reserved handle
+		void reject();
 
 	private:
 		IPC_ACCEPTOR			mIPCAcceptor; //!< IPC_ACCEPTOR used by the Acceptor
+		mutable ALLOCATOR		mAllocator; //!< Allocator of the SVC_HANDLER
 		bool					mIsSuspended; //!< Suspend/Resume flag
+		bool					mIsNonBlocking; //!< Whether the IPC_ACCEPTOR is non blocking
+		size_t					mAcceptBatch; //!< Maximum number of connections accepted per read event
+		uint8_t					mHandlerFlags; //!< Options of the accepted handles
+		SockDatagram			mReserve; //!< Handle released when the handles are exhausted
+		SocketProfile			mProfile; //!< TCP options of the SVC_HANDLER peers
+		size_t					mMaxConnections; //!< Maximum number of connections
+		ConnectionCount*		mConnections; //!< Live SVC_HANDLER, shared with them
+		size_t					mMaxResidentSize; //!< Maximum resident memory
+		Time					mMaxLoopLag; //!< Maximum lag of the reactor loop
+		Time					mOverloadCheck; //!< Interval between two checks of the limits
+		Time					mNextMemoryCheck; //!< Time of the next sample of the resident memory
+		long					mResidentSize; //!< Last sample of the resident memory
+		long					mOverloadTimer; //!< Identifier of the overload check timer or -1
+		unsigned long			mRejectedCount; //!< Number of connections rejected
+		unsigned long			mOverloadCount; //!< Number of overloads
 		Reactor<SYNC_POLICY>*	mReactor; //!< Dispatcher used to retrieve events
 };
 
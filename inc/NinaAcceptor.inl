@@ -21,35 +21,109 @@
 
 NINA_BEGIN_NAMESPACE_DECL
 
-template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE int
-Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR>::handleRead(NINAHandle)
-{
-	return accept();
-}
-
-template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE NINAHandle
-Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR>::getHandle() const
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE NINAHandle
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::getHandle() const
 {
 	return mIPCAcceptor.getHandle();
 }
 
-template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE int
-Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR>::suspend()
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE int
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::suspend()
 {
 	mIsSuspended = true;
 	return mReactor->removeHandler(this, Events::ACCEPT);
 }
 
-template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE int
-Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR>::resume()
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE int
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::resume()
 {
 	return mReactor->registerHandler(this, Events::ACCEPT);
 }
 
-template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE SVC_HANDLER*
-Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR>::makeServiceHandler() const
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE void
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::setAcceptBatch(size_t batch)
+{
+	mAcceptBatch = (batch > 0 ? batch : 1);
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE void
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::setHandlerFlags(uint8_t flags)
+{
+	mHandlerFlags = flags;
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE int
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::steerByCPU(unsigned int groupSize)
+{
+	return mIPCAcceptor.steerByCPU(groupSize);
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE int
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::getLocalAddr(_Addr& addr) const
+{
+	return mIPCAcceptor.getLocalAddr(addr);
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE ALLOCATOR&
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::getAllocator()
+{
+	return mAllocator;
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE void
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::setMaxConnections(size_t max)
+{
+	mMaxConnections = max;
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE void
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::setMaxResidentSize(size_t max)
+{
+	mMaxResidentSize = max;
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE void
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::setMaxLoopLag(Time const& max)
+{
+	mMaxLoopLag = max;
+	if (max != Time::timeNull)
+		mReactor->setLoopLagTracking(true);
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE void
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::setOverloadCheck(Time const& interval)
+{
+	mOverloadCheck = interval;
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE bool
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::isOverloaded() const
+{
+	return mOverloadTimer != -1;
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE unsigned long
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::getRejectedCount() const
+{
+	return mRejectedCount;
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE unsigned long
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::getOverloadCount() const
+{
+	return mOverloadCount;
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE size_t
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::getConnectionCount() const
+{
+	return mConnections->getLive();
+}
+
+template <class SVC_HANDLER, class IPC_ACCEPTOR, class SYNC_POLICY, bool THROW_ON_ERR, class ALLOCATOR> NINA_INLINE SVC_HANDLER*
+Acceptor<SVC_HANDLER, IPC_ACCEPTOR, SYNC_POLICY, THROW_ON_ERR, ALLOCATOR>::makeServiceHandler() const
 {
-	return new SVC_HANDLER;
+	return mAllocator.allocate();
 }
 
 NINA_END_NAMESPACE_DECL
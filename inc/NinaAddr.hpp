@@ -47,7 +47,7 @@ class NINA_DLLREQ Addr
 	protected:
 		/*! @brief Constructor
 		 * @details Constructor of the class Addr
-		 * @param[in] family : the address family, types supported are AF_INET/AF_INET6/AF_UNSPEC
+		 * @param[in] family : the address family, types supported are AF_INET/AF_INET6/AF_UNIX/AF_UNSPEC
 		 * @param[in] size : size of address container
 		 */
 		Addr(int family = AF_ANY, int size = -1);
@@ -65,7 +65,7 @@ class NINA_DLLREQ Addr
 		//! @return Address family or -1 on error
 		int getFamily() const;
 		//! @brief Set the family address
-		//! @param[in] family : the address family, types supported are AF_INET/AF_INET6/AF_UNSPEC
+		//! @param[in] family : the address family, types supported are AF_INET/AF_INET6/AF_UNIX/AF_UNSPEC
 		void setFamily(int family);
 		//! @brief Get the size of address container
 		//! @return Size of address container or -1 on error
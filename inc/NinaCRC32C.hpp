@@ -0,0 +1,96 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaCRC32C.hpp
+ * @brief Defines the CRC32C checksum of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_CRC32C_HPP__
+# define __NINA_CRC32C_HPP__
+
+# include "NinaDef.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class CRC32C
+ * @brief CRC32C (Castagnoli) checksum
+ *
+ * @details This class computes the CRC32C of a byte stream incrementally.<br/>
+ * It relies on the SSE4.2 crc32 instruction or on the ARMv8 CRC extension when the processor supports them,
+ * otherwise a slice-by-8 table driven implementation is used.<br/>
+ * On the wire, a checksum is written as hexadecimal digits so that it never holds the delimiter of a frame
+ * (see PacketFactory)
+ */
+class NINA_DLLREQ CRC32C
+{
+	public:
+		enum {
+			SIZE = 8 //!< Size of a checksum on the wire
+		};
+
+	public:
+		//! @brief Constructor
+		CRC32C();
+		//! @brief Destructor
+		~CRC32C() {};
+		//! @brief Copy constructor
+		CRC32C(CRC32C const& crc);
+		//! @brief Assignement operator
+		CRC32C& operator=(CRC32C const& crc);
+
+	public:
+		/*!
+		 * @brief Update the checksum with new bytes
+		 * @param[in] data : bytes to process
+		 * @param[in] len : number of bytes
+		 */
+		void update(void const* data, size_t len);
+		//! @brief Get the checksum of the bytes processed so far
+		uint32_t getValue() const;
+		//! @brief Reset the checksum as if no bytes were processed
+		void reset();
+		/*!
+		 * @brief Compute the checksum of a buffer
+		 * @param[in] data : bytes to process
+		 * @param[in] len : number of bytes
+		 * @param[in] crc : checksum of the preceding bytes, used to chain computations
+		 * @return the checksum
+		 */
+		static uint32_t compute(void const* data, size_t len, uint32_t crc = 0);
+		//! @brief Store a checksum as SIZE lowercase hexadecimal digits, most significant first (the wire format of the trailers)
+		static void store(uint32_t crc, char* buf);
+		/*!
+		 * @brief Load a checksum stored by store
+		 * @param[in] buf : SIZE hexadecimal digits, either lowercase or uppercase
+		 * @param[out] crc : the checksum
+		 * @return 0 on success or -1 if the buffer holds other characters
+		 */
+		static int load(char const* buf, uint32_t* crc);
+		//! @brief Check whether a character is used by the checksums on the wire
+		static bool isDigit(char c);
+		//! @brief Check whether the checksum is computed by the processor
+		static bool isHardwareAccelerated();
+
+	private:
+		uint32_t	mValue; //!< Checksum of the bytes processed so far
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaCRC32C.inl"
+
+#endif /* !__NINA_CRC32C_HPP__ */
@@ -0,0 +1,97 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaCRC32C.inl
+ * @brief Implements the CRC32C checksum of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE
+CRC32C::CRC32C()
+	: mValue(0)
+{
+}
+
+NINA_INLINE
+CRC32C::CRC32C(CRC32C const& crc)
+	: mValue(crc.mValue)
+{
+}
+
+NINA_INLINE CRC32C&
+CRC32C::operator=(CRC32C const& crc)
+{
+	mValue = crc.mValue;
+	return *this;
+}
+
+NINA_INLINE void
+CRC32C::update(void const* data, size_t len)
+{
+	mValue = compute(data, len, mValue);
+}
+
+NINA_INLINE uint32_t
+CRC32C::getValue() const
+{
+	return mValue;
+}
+
+NINA_INLINE void
+CRC32C::reset()
+{
+	mValue = 0;
+}
+
+NINA_INLINE void
+CRC32C::store(uint32_t crc, char* buf)
+{
+	static char const	digits[] = "0123456789abcdef";
+
+	for (int i = SIZE - 1; i >= 0; --i, crc >>= 4)
+		buf[i] = digits[crc & 0xF];
+}
+
+NINA_INLINE int
+CRC32C::load(char const* buf, uint32_t* crc)
+{
+	uint32_t	value = 0;
+	char		c;
+
+	for (int i = 0; i < SIZE; ++i) {
+		c = buf[i];
+		if (c >= '0' && c <= '9')
+			value = (value << 4) | (c - '0');
+		else if (c >= 'a' && c <= 'f')
+			value = (value << 4) | (c - 'a' + 10);
+		else if (c >= 'A' && c <= 'F')
+			value = (value << 4) | (c - 'A' + 10);
+		else
+			return -1;
+	}
+	*crc = value;
+	return 0;
+}
+
+NINA_INLINE bool
+CRC32C::isDigit(char c)
+{
+	return ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'));
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,207 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaConnectionPool.hpp
+ * @brief Defines the outbound connection pool of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_CONNECTIONPOOL_HPP__
+# define __NINA_CONNECTIONPOOL_HPP__
+
+# include <map>
+# include <list>
+# include <utility>
+# include "NinaDef.hpp"
+# include "NinaOS.hpp"
+# include "NinaEventHandler.hpp"
+# include "NinaReactor.hpp"
+# include "NinaInetAddr.hpp"
+# include "NinaSockStream.hpp"
+# include "NinaSockConnector.hpp"
+# include "NinaTime.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class ConnectionPool
+ * @brief Keep warm outbound connections per backend
+ *
+ * @details This class keeps established SockStreams to a set of backends in order to reuse them across
+ * requests, saving the handshake and the slow start of a new connection<br/>
+ * Idle connections are handed out in logarithmic time, the most recently released first. Meanwhile they are monitored
+ * by the reactor: an idle connection becoming readable has been closed by its peer (or is out of sync) and is evicted<br/>
+ * A periodic sweep evicts the connections idle for too long, aborts the connections which take too long
+ * to establish, and opens new ones to keep at least minIdle connections per backend<br/>
+ * Connections are always established asynchronously and the number of connections in progress is capped<br/>
+ * Pooled connections are in non blocking mode
+ * @arg SYNC_POLICY : policy used by the dispatcher (see NINA::Reactor)
+ */
+template <class SYNC_POLICY = NINADefaultPolicy>
+class ConnectionPool : public EventHandler
+{
+	public:
+		enum
+		{
+			DEFAULT_MAX_IDLE = 8, //!< Default maximum number of idle connections per backend
+			DEFAULT_MAX_CONNECTING = 64 //!< Default maximum number of connections in progress
+		};
+
+	private:
+		//! An idle connection
+		struct IdleConnection
+		{
+			IdleConnection() : handle(NINA_INVALID_HANDLE), since(0, 0) {};
+
+			NINAHandle	handle; //!< Handle of the connection
+			Time		since; //!< Time of the release
+		};
+		//! Idle connections of a backend, the most recently released last
+		typedef std::list<IdleConnection> IdleList;
+		//! State of a backend
+		struct Backend
+		{
+			IdleList	idle; //!< Idle connections
+			size_t		connecting; //!< Connections in progress
+		};
+		//! Backends by address
+		typedef std::map<InetAddr, Backend> BackendTable;
+		//! Position of an idle connection
+		typedef std::pair<typename BackendTable::iterator, typename IdleList::iterator> IdleLocation;
+		//! Associate an idle handle with its position
+		typedef std::map<NINAHandle, IdleLocation> IdleTable;
+		//! A connection in progress
+		struct PendingConnection
+		{
+			PendingConnection() : since(0, 0) {};
+
+			typename BackendTable::iterator	backend; //!< Backend being connected
+			Time							since; //!< Start of the attempt
+		};
+		//! Associate an handle with its connection in progress
+		typedef std::map<NINAHandle, PendingConnection> PendingTable;
+
+	public:
+		/*!
+		 * @brief Constructor
+		 * @param[in] reactor : a pointer on the dispatcher used to monitor the connections
+		 * @param[in] minIdle : number of idle connections kept open per backend
+		 * @param[in] maxIdle : maximum number of idle connections per backend, the others are closed on release
+		 * @param[in] maxConnecting : maximum number of connections in progress, all backends included
+		 * @throw std::invalid_argument if the reactor is invalid
+		 */
+		ConnectionPool(Reactor<SYNC_POLICY>* reactor, size_t minIdle = 0, size_t maxIdle = DEFAULT_MAX_IDLE,
+				size_t maxConnecting = DEFAULT_MAX_CONNECTING);
+		//! @brief Virtual destructor, all the pooled connections are closed
+		virtual ~ConnectionPool();
+	private:
+		//! @brief Copy constructor (not implemented, handles can't be shared)
+		ConnectionPool(ConnectionPool const& pool);
+		//! @brief Assignment operator (not implemented, handles can't be shared)
+		ConnectionPool& operator=(ConnectionPool const& pool);
+
+	public:
+		//! @brief Handle the activity of an idle connection (evicted)
+		virtual int handleRead(NINAHandle handle);
+		//! @brief Handle the completion of a connection in progress
+		virtual int handleWrite(NINAHandle handle);
+		//! @brief Handle urgent events (unused)
+		virtual int handleUrgent(NINAHandle) {return 0;};
+		//! @brief Handle timeout events (unused)
+		virtual int handleTimeout(NINAHandle) {return 0;};
+		//! @brief Handle signal events (unused)
+		virtual int handleSignal(NINAHandle) {return 0;};
+		//! @brief Handle close events (unused)
+		virtual int handleClose(NINAHandle) {return 0;};
+		//! @brief Handle the periodic sweep
+		virtual int handleTimer(long timerId);
+		//! @brief Handle the start of a drain, the connection is closed and the sweep stopped (see Reactor::drain)
+		virtual int handleDrain(NINAHandle handle);
+		//! @brief The pool has no handle of its own, it registers the handles of its connections
+		virtual NINAHandle getHandle() const {return NINA_INVALID_HANDLE;};
+		/*!
+		 * @brief Declare a backend and start the connections needed to reach minIdle
+		 * @param[in] addr : address of the backend
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int warm(InetAddr const& addr);
+		/*!
+		 * @brief Take an idle connection to a backend
+		 * @details If no connection is idle, a new one is started in the background (see handleReady)
+		 * @param[in] addr : address of the backend
+		 * @param[out] stream : the stream receiving the connection, it then owns the handle
+		 * @return 0 on success or -1 if no connection is idle (errno is set to EWOULDBLOCK)
+		 */
+		int acquire(InetAddr const& addr, SockStream& stream);
+		/*!
+		 * @brief Give a connection back to the pool
+		 * @details The connection must be in a clean state, namely without any pending request<br/>
+		 * It is closed if the backend already has maxIdle idle connections
+		 * @param[in] addr : address of the backend
+		 * @param[in,out] stream : the stream holding the connection, the pool then owns the handle
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int release(InetAddr const& addr, SockStream& stream);
+		//! @brief Set the age from which an idle connection is evicted (one minute by default)
+		void setMaxIdleAge(Time const& age);
+		//! @brief Set the maximum duration of a connection attempt (five seconds by default)
+		void setConnectTimeout(Time const& timeout);
+		//! @brief Set the period of the sweep (one second by default)
+		void setSweepInterval(Time const& interval);
+		//! @brief Get the number of idle connections to a backend
+		size_t getIdleCount(InetAddr const& addr) const;
+		//! @brief Get the number of connections in progress, all backends included
+		size_t getConnectingCount() const;
+
+	protected:
+		//! @brief Notify that a new idle connection to a backend is available
+		virtual void handleReady(InetAddr const&) {};
+
+	private:
+		//! @brief Get a backend, creating it if needed
+		typename BackendTable::iterator getBackend(InetAddr const& addr);
+		//! @brief Start an asynchronous connection to a backend
+		int startConnection(typename BackendTable::iterator backend);
+		//! @brief Start the connections needed to reach minIdle on a backend
+		void replenish(typename BackendTable::iterator backend);
+		//! @brief Monitor a connection and add it to the idle ones
+		void addIdle(typename BackendTable::iterator backend, NINAHandle handle);
+		//! @brief Stop monitoring an idle connection and return its handle
+		NINAHandle removeIdle(typename IdleTable::iterator idle);
+
+	private:
+		BackendTable			mBackends; //!< Known backends
+		IdleTable				mIdle; //!< Idle connections
+		PendingTable			mPending; //!< Connections in progress
+		SockConnector			mConnector; //!< Connector used to start the connections
+		size_t					mMinIdle; //!< Idle connections kept per backend
+		size_t					mMaxIdle; //!< Maximum idle connections per backend
+		size_t					mMaxConnecting; //!< Maximum connections in progress
+		Time					mMaxIdleAge; //!< Age from which an idle connection is evicted
+		Time					mConnectTimeout; //!< Maximum duration of a connection attempt
+		Time					mSweepInterval; //!< Period of the sweep
+		long					mSweepTimer; //!< Timer of the sweep or -1
+		Reactor<SYNC_POLICY>*	mReactor; //!< Dispatcher used to monitor the connections
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaConnectionPool.imp"
+# include "NinaConnectionPool.inl"
+
+#endif /* !__NINA_CONNECTIONPOOL_HPP__ */
@@ -0,0 +1,60 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaConnectionPool.inl
+ * @brief Implements the outbound connection pool of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+template <class SYNC_POLICY> NINA_INLINE void
+ConnectionPool<SYNC_POLICY>::setMaxIdleAge(Time const& age)
+{
+	mMaxIdleAge = age;
+}
+
+template <class SYNC_POLICY> NINA_INLINE void
+ConnectionPool<SYNC_POLICY>::setConnectTimeout(Time const& timeout)
+{
+	mConnectTimeout = timeout;
+}
+
+template <class SYNC_POLICY> NINA_INLINE void
+ConnectionPool<SYNC_POLICY>::setSweepInterval(Time const& interval)
+{
+	mSweepInterval = interval;
+}
+
+template <class SYNC_POLICY> NINA_INLINE size_t
+ConnectionPool<SYNC_POLICY>::getIdleCount(InetAddr const& addr) const
+{
+	typename BackendTable::const_iterator	backend;
+
+	backend = mBackends.find(addr);
+	if (backend == mBackends.end())
+		return 0;
+	return backend->second.idle.size();
+}
+
+template <class SYNC_POLICY> NINA_INLINE size_t
+ConnectionPool<SYNC_POLICY>::getConnectingCount() const
+{
+	return mPending.size();
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,247 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaConnector.hpp
+ * @brief Defines the connector design pattern
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_CONNECTOR_HPP__
+# define __NINA_CONNECTOR_HPP__
+
+# include <map>
+# include <vector>
+# include "NinaDef.hpp"
+# include "NinaEventHandler.hpp"
+# include "NinaSockConnector.hpp"
+# include "NinaReactor.hpp"
+# include "NinaSystemError.hpp"
+# include "NinaSAP.hpp"
+# include "NinaTime.hpp"
+# include "NinaSocketProfile.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class Connector
+ * @brief Establish outgoing connections and start the appropriate service
+ *
+ * @details This class is the counterpart of NINA::Acceptor: it issues non blocking connections then waits
+ * for their completion through the reactor, so that thousands of connections may be pending without stalling
+ * the event loop<br/>
+ * Once a connection is established its SO_ERROR is checked, then the SVC_HANDLER::init function is called<br/>
+ * Each attempt may be bounded by a timeout which is enforced by a reactor timer (see Reactor::scheduleTimer)<br/>
+ * When a peer has several addresses (see NINA::InetAddrList), the Connector races them: attempts are started one after
+ * the other at a fixed interval, or as soon as the previous one failed, the first to succeed is kept and the others are
+ * aborted (RFC 8305). Thus a dead address only delays the connection by the attempt delay instead of a full timeout
+ * @arg SVC_HANDLER : service launched once connected (see NINA::ServiceHandler)
+ * @arg IPC_CONNECTOR : underlying IPC class used by the Connector
+ * @arg SYNC_POLICY : policy used by the dispatcher (see NINA::Reactor)
+ * @throw NINA::Error::SystemError if THROW_ON_ERR is true and an error occured while completing a connection
+ * (note that if an exception occured, it will be thrown during the event loop see: Reactor::handleEvents)
+ */
+template <class SVC_HANDLER, class IPC_CONNECTOR = SockConnector,
+		 class SYNC_POLICY = NINADefaultPolicy, bool THROW_ON_ERR = true>
+class Connector : public EventHandler
+{
+	public:
+		//! Adress class associated with the SVC_HANDLER<br/>
+		//! Note that the name _Addr isn't trivial, in fact all address classes descend from NINA::Addr
+		typedef typename SVC_HANDLER::_Addr _Addr;
+		//! Addresses of a peer, raced in order (see NINA::InetAddrList)
+		typedef std::vector<_Addr> AddrList;
+		//! Default delay between two attempts of a race in microseconds (RFC 8305 section 5)
+		enum { DEFAULT_ATTEMPT_DELAY = 250000 };
+
+	private:
+		//! IPC stream class of the SVC_HANDLER
+		typedef typename SVC_HANDLER::_Stream _Stream;
+		//! A connection in progress
+		struct PendingConnection
+		{
+			SVC_HANDLER*	serviceHandler; //!< Service waiting for the connection
+			long			timerId; //!< Timer bounding the attempt or -1
+		};
+		//! Associate an handle with its connection in progress
+		typedef std::map<NINAHandle, PendingConnection> PendingTable;
+		//! Associate a timer with the handle it bounds
+		typedef std::map<long, NINAHandle> TimerTable;
+		//! An attempt of a race
+		struct Attempt
+		{
+			_Stream*	peer; //!< Endpoint of the attempt
+			size_t		index; //!< Index of the address tried
+		};
+		//! Connections raced to several addresses of the same peer
+		struct Race
+		{
+			AddrList				addrs; //!< Addresses to try
+			size_t					next; //!< Index of the next address to try
+			std::vector<Attempt>	attempts; //!< Attempts in progress
+			int						protocol; //!< Protocol used by the underlying streams
+			int						lastError; //!< Error of the last failed attempt
+			long					delayTimerId; //!< Timer starting the next attempt or -1
+			long					timerId; //!< Timer bounding the race or -1
+		};
+		//! Associate the service waiting for the winner with its race
+		typedef std::map<SVC_HANDLER*, Race> RaceTable;
+		//! Associate the handle of an attempt with the service of its race
+		typedef std::map<NINAHandle, SVC_HANDLER*> AttemptTable;
+		//! Associate a race timer with the service of its race
+		typedef std::map<long, SVC_HANDLER*> RaceTimerTable;
+
+	public:
+		/*! @brief Constructor
+		 * @details Constructor of the class Connector
+		 * @param[in] reactor : a pointer on the dispatcher used to complete the connections
+		 * @throw std::invalid_argument if the reactor is invalid
+		 */
+		Connector(Reactor<SYNC_POLICY>* reactor);
+		//! @brief Virtual destructor, the connections in progress are aborted
+		virtual ~Connector();
+		//! @brief Copy constructor (the connections in progress are not copied)
+		Connector(Connector const& connector);
+		//! @brief Assignment operator (the connections in progress are not copied)
+		Connector& operator=(Connector const& connector);
+
+	public:
+		//! @brief Handle read events (unused)
+		virtual int handleRead(NINAHandle) {return 0;};
+		//! @brief Handle the completion of a connection in progress
+		//! @throw NINA::Error::SystemError if THROW_ON_ERR is true and the connection failed
+		virtual int handleWrite(NINAHandle handle);
+		//! @brief Handle urgent events (unused)
+		virtual int handleUrgent(NINAHandle) {return 0;};
+		//! @brief Handle timeout events (unused)
+		virtual int handleTimeout(NINAHandle) {return 0;};
+		//! @brief Handle signal events (unused)
+		virtual int handleSignal(NINAHandle) {return 0;};
+		//! @brief Handle close events (unused)
+		virtual int handleClose(NINAHandle) {return 0;};
+		//! @brief Handle the expiration of a connection attempt
+		//! @throw NINA::Error::SystemError if THROW_ON_ERR is true
+		virtual int handleTimer(long timerId);
+		//! @brief Handle the start of a drain, the connection in progress is aborted (see Reactor::drain)
+		virtual int handleDrain(NINAHandle handle);
+		//! @brief The Connector has no handle of its own, it registers the handles of the connections in progress
+		virtual NINAHandle getHandle() const {return NINA_INVALID_HANDLE;};
+		/*!
+		 * @brief Start a connection and initialize the SVC_HANDLER once it is established
+		 * @details The Connector takes the ownership of the SVC_HANDLER until SVC_HANDLER::init is called:
+		 * it is destroyed if the connection fails (see ServiceHandler::destroy)
+		 * @param[in] addr : the address of the remote peer
+		 * @param[in] timeout : maximum duration of the attempt, 0 to wait for the system to give up
+		 * @param[in] serviceHandler : the service to connect, if 0 one is created (see makeServiceHandler)
+		 * @param[in] protocol : protocol used by the underlying stream
+		 * @return 0 if the connection is established or in progress or -1 on error<br/>
+		 * If an error occurred errno will be set accordingly apart from the case where SVC_HANDLER::init produces the error
+		 */
+		virtual int connect(_Addr const& addr, Time const* timeout = 0,
+				SVC_HANDLER* serviceHandler = 0, int protocol = IPPROTO_TCP);
+		/*!
+		 * @brief Race connections to several addresses of a peer and initialize the SVC_HANDLER with the first established
+		 * @details An attempt is started for the first address, then the next address is tried whenever the attempt
+		 * delay elapsed or every attempt in progress failed (see setAttemptDelay). Once a connection is established,
+		 * the others are aborted and the remote address of the SVC_HANDLER is set to the address which answered<br/>
+		 * The ownership of the SVC_HANDLER is the same as for a single address
+		 * @param[in] addrs : the addresses of the remote peer by order of preference (see NINA::InetAddrList)
+		 * @param[in] timeout : maximum duration of the whole race, 0 to wait for the system to give up on every address
+		 * @param[in] serviceHandler : the service to connect, if 0 one is created (see makeServiceHandler)
+		 * @param[in] protocol : protocol used by the underlying stream
+		 * @return 0 if the race is in progress or -1 on error (EINVAL if there is no address)<br/>
+		 * If no attempt could even be started, errno is set according to the last failure
+		 */
+		virtual int connect(AddrList const& addrs, Time const* timeout = 0,
+				SVC_HANDLER* serviceHandler = 0, int protocol = IPPROTO_TCP);
+		/*!
+		 * @brief Set the options of the established SVC_HANDLER peers
+		 * @details Connections are always made in non blocking mode, this sets the mode they are handed over with
+		 * @param[in] flags : a bit set composed of SAP::NON_BLOCK/SAP::CLOSE_ON_EXEC
+		 */
+		void setHandlerFlags(uint8_t flags);
+		/*!
+		 * @brief Set the TCP options of the SVC_HANDLER peers, they are set before connecting (see SocketProfile)
+		 * @param[in] profile : the options to set
+		 */
+		void setSocketProfile(SocketProfile const& profile);
+		/*!
+		 * @brief Set the delay between two attempts of a race
+		 * @param[in] delay : the delay to set, #DEFAULT_ATTEMPT_DELAY by default
+		 */
+		void setAttemptDelay(Time const& delay);
+		//! @brief Get the number of connections in progress (a race counts as one connection)
+		size_t getPendingCount() const;
+
+	protected:
+		//! @brief SVC_HANDLER factory method
+		virtual SVC_HANDLER* makeServiceHandler() const;
+		/*!
+		 * @brief Open the SVC_HANDLER peer and start a non blocking connection
+		 * @return 0 if the connection is established, 1 if it is in progress or -1 on error
+		 */
+		virtual int connectServiceHandler(SVC_HANDLER* serviceHandler, _Addr const& addr, int protocol);
+		/*!
+		 * @brief Open a peer and start a non blocking connection
+		 * @return 0 if the connection is established, 1 if it is in progress or -1 on error
+		 */
+		virtual int connectPeer(_Stream& peer, _Addr const& addr, int protocol);
+		//! @brief Set the SVC_HANDLER peer options then initialize it
+		virtual int initServiceHandler(SVC_HANDLER* serviceHandler) const;
+		/*!
+		 * @brief Handle a connection which failed while in progress
+		 * @details The default implementation destroys the SVC_HANDLER then throws if THROW_ON_ERR is true
+		 * @param[in] serviceHandler : the service which could not be connected
+		 * @param[in] err : the error code of the failure (ETIMEDOUT if the timeout expired)
+		 */
+		virtual void failServiceHandler(SVC_HANDLER* serviceHandler, int err);
+
+	private:
+		//! @brief Forget a connection in progress and return its SVC_HANDLER
+		SVC_HANDLER* removePending(typename PendingTable::iterator pending);
+		//! @brief Initialize the SVC_HANDLER of a completed connection
+		//! @throw NINA::Error::SystemError if THROW_ON_ERR is true and the initialization failed
+		void establishServiceHandler(SVC_HANDLER* serviceHandler);
+		/*!
+		 * @brief Start the next attempt of a race, skipping the addresses which fail right away
+		 * @return 0 if an attempt was started or -1 if there is no address left
+		 */
+		int startAttempt(typename RaceTable::iterator race);
+		//! @brief Handle the completion of an attempt
+		void completeAttempt(typename RaceTable::iterator race, NINAHandle handle);
+		//! @brief Handle the expiration of a race timer
+		void expireRace(typename RaceTable::iterator race, long timerId);
+		//! @brief Abort the attempts in progress of a race, forget it and return its SVC_HANDLER
+		SVC_HANDLER* removeRace(typename RaceTable::iterator race);
+
+	private:
+		IPC_CONNECTOR			mIPCConnector; //!< IPC_CONNECTOR used by the Connector
+		PendingTable			mPending; //!< Connections in progress
+		TimerTable				mTimers; //!< Timers bounding the connections in progress
+		RaceTable				mRaces; //!< Races in progress
+		AttemptTable			mAttempts; //!< Handles of the attempts in progress
+		RaceTimerTable			mRaceTimers; //!< Timers of the races in progress
+		uint8_t					mHandlerFlags; //!< Options of the established handles
+		SocketProfile			mProfile; //!< TCP options of the SVC_HANDLER peers
+		Time					mAttemptDelay; //!< Delay between two attempts of a race
+		Reactor<SYNC_POLICY>*	mReactor; //!< Dispatcher used to complete the connections
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaConnector.imp"
+# include "NinaConnector.inl"
+
+#endif /* !__NINA_CONNECTOR_HPP__ */
@@ -0,0 +1,55 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaConnector.inl
+ * @brief Implements the connector design pattern (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+template <class SVC_HANDLER, class IPC_CONNECTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE void
+Connector<SVC_HANDLER, IPC_CONNECTOR, SYNC_POLICY, THROW_ON_ERR>::setHandlerFlags(uint8_t flags)
+{
+	mHandlerFlags = flags;
+}
+
+template <class SVC_HANDLER, class IPC_CONNECTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE void
+Connector<SVC_HANDLER, IPC_CONNECTOR, SYNC_POLICY, THROW_ON_ERR>::setSocketProfile(SocketProfile const& profile)
+{
+	mProfile = profile;
+}
+
+template <class SVC_HANDLER, class IPC_CONNECTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE void
+Connector<SVC_HANDLER, IPC_CONNECTOR, SYNC_POLICY, THROW_ON_ERR>::setAttemptDelay(Time const& delay)
+{
+	mAttemptDelay = delay;
+}
+
+template <class SVC_HANDLER, class IPC_CONNECTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE size_t
+Connector<SVC_HANDLER, IPC_CONNECTOR, SYNC_POLICY, THROW_ON_ERR>::getPendingCount() const
+{
+	return mPending.size() + mRaces.size();
+}
+
+template <class SVC_HANDLER, class IPC_CONNECTOR, class SYNC_POLICY, bool THROW_ON_ERR> NINA_INLINE SVC_HANDLER*
+Connector<SVC_HANDLER, IPC_CONNECTOR, SYNC_POLICY, THROW_ON_ERR>::makeServiceHandler() const
+{
+	return new SVC_HANDLER;
+}
+
+NINA_END_NAMESPACE_DECL
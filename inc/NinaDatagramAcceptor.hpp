@@ -0,0 +1,147 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaDatagramAcceptor.hpp
+ * @brief Defines the datagram acceptor pattern of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_DATAGRAMACCEPTOR_HPP__
+# define __NINA_DATAGRAMACCEPTOR_HPP__
+
+# include "NinaDef.hpp"
+# include "NinaEventHandler.hpp"
+# include "NinaDatagramHandler.hpp"
+# include "NinaDatagramBatch.hpp"
+# include "NinaSockDatagram.hpp"
+# include "NinaInetAddrMap.hpp"
+# include "NinaReactor.hpp"
+# include "NinaSAP.hpp"
+# include "NinaServiceAllocator.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class DatagramAcceptor
+ * @brief Demultiplex the datagrams of a single socket into per peer sessions
+ *
+ * @details This class brings the Acceptor/ServiceHandler model to datagram protocols without a socket per peer:
+ * the datagrams are received in batches (see SockDatagram::receiveBatch), then each of them is looked up by the
+ * address of its sender in a hash table (see NINA::InetAddrMap). The first datagram of an unknown address creates
+ * a SVC_HANDLER and calls its init function, every datagram is then handed to SVC_HANDLER::handleDatagram.<br/>
+ * The sessions are tracked by the idle timeouts of the reactor (see Reactor::trackIdle): each datagram only stamps
+ * the activity of its session, thus expiring the idle ones never scans the table.<br/>
+ * Once the kernel timestamps are enabled on the socket (see SockIO::setTimestamping), the reactor records the
+ * receive latency of each datagram before handing it (see Reactor::recordReceiveLatency)
+ * @arg SVC_HANDLER : session created per peer (see NINA::DatagramHandler)
+ * @arg SYNC_POLICY : policy used by the dispatcher (see NINA::Reactor)
+ * @arg ALLOCATOR : allocator of the SVC_HANDLER (see NINA::NewAllocator, NINA::RecycleAllocator)
+ */
+template <class SVC_HANDLER, class SYNC_POLICY = NINADefaultPolicy,
+		 class ALLOCATOR = NewAllocator<SVC_HANDLER> >
+class DatagramAcceptor : public EventHandler, private DatagramHandler::Owner
+{
+	public:
+		//! Address class of the peers
+		typedef InetAddr _Addr;
+		//! Maximum number of batches received per read event, so that a flood does not starve the other handles
+		enum { MAX_BATCHES = 8 };
+
+	public:
+		/*! @brief Constructor
+		 * @param[in] reactor : a pointer on the dispatcher used to retrieve socket events
+		 * @param[in] batch : maximum number of datagrams received per system call
+		 * @param[in] datagramSize : maximum size of a datagram, larger ones are truncated
+		 * @throw std::invalid_argument if the reactor is invalid
+		 */
+		DatagramAcceptor(Reactor<SYNC_POLICY>* reactor, size_t batch = DatagramBatch::DEFAULT_CAPACITY,
+				size_t datagramSize = DatagramBatch::DEFAULT_DATAGRAM_SIZE);
+		//! @brief Virtual destructor, the sessions are closed
+		virtual ~DatagramAcceptor();
+		//! @brief Copy constructor (neither the socket nor the sessions are copied)
+		DatagramAcceptor(DatagramAcceptor const& acceptor);
+		//! @brief Assignment operator (neither the socket nor the sessions are copied)
+		DatagramAcceptor& operator=(DatagramAcceptor const& acceptor);
+
+	public:
+		//! @brief Receive the pending datagrams and route them to their session
+		virtual int handleRead(NINAHandle handle);
+		virtual int handleWrite(NINAHandle) {return 0;};
+		virtual int handleUrgent(NINAHandle) {return 0;};
+		virtual int handleTimeout(NINAHandle) {return 0;};
+		virtual int handleSignal(NINAHandle) {return 0;};
+		virtual int handleClose(NINAHandle) {return 0;};
+		//! @brief Handle the start of a drain, the sessions are closed along with the socket (see Reactor::drain)
+		virtual int handleDrain(NINAHandle);
+		//! @brief Get the underlying handle to process double dispatching
+		virtual NINAHandle getHandle() const;
+		/*!
+		 * @brief Open the socket in non blocking mode and register it in the reactor
+		 * @param[in] addr : the address the socket is bound on
+		 * @param[in] family : family of the socket
+		 * @param[in] reuseAddr : specify if the binding will be reusable
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		virtual int open(_Addr const& addr, int family = PF_UNSPEC, bool reuseAddr = false);
+		//! @brief Close every session, then remove the socket from the reactor and close it
+		void close();
+		/*!
+		 * @brief Set the inactivity after which a session ends (see EventHandler::handleIdle)
+		 * @details It applies to the sessions created afterwards
+		 * @param[in] timeout : the timeout, Time::timeNull to never expire the sessions (default)
+		 */
+		void setIdleTimeout(Time const& timeout);
+		//! @brief Get the session of a peer
+		//! @return a pointer on the session or 0 if the peer has none
+		SVC_HANDLER* getSession(_Addr const& addr);
+		//! @brief Get the number of sessions
+		size_t getSessionCount() const;
+		//! @brief Get the socket shared by the sessions
+		SockDatagram& getSocket();
+		//! @brief Get the allocator of the SVC_HANDLER (to retrieve its statistics or tune it)
+		ALLOCATOR& getAllocator();
+
+	protected:
+		//! @brief SVC_HANDLER factory method (see ALLOCATOR)
+		virtual SVC_HANDLER* makeServiceHandler() const;
+		//! @brief Initialize the SVC_HANDLER of a new peer
+		virtual int initServiceHandler(SVC_HANDLER* serviceHandler);
+		/*!
+		 * @brief Route a datagram to the session of its sender, creating it if needed
+		 * @param[in] idx : index of the datagram in the batch
+		 */
+		virtual void dispatch(size_t idx);
+
+	private:
+		//! @brief Remove a session from the table then destroy it
+		virtual void release(DatagramHandler* handler);
+
+	private:
+		SockDatagram					mSock; //!< Socket shared by the sessions
+		DatagramBatch					mBatch; //!< Datagrams received by the last system call
+		InetAddrMap<SVC_HANDLER*>		mSessions; //!< Sessions indexed by the address of their peer
+		InetAddrKey						mKey; //!< Key of the datagram being dispatched
+		mutable ALLOCATOR				mAllocator; //!< Allocator of the SVC_HANDLER
+		Time							mIdleTimeout; //!< Inactivity after which a session ends
+		Reactor<SYNC_POLICY>*			mReactor; //!< Dispatcher used to retrieve events
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaDatagramAcceptor.imp"
+# include "NinaDatagramAcceptor.inl"
+
+#endif /* !__NINA_DATAGRAMACCEPTOR_HPP__ */
@@ -0,0 +1,69 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaDatagramAcceptor.inl
+ * @brief Implements the datagram acceptor pattern of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+template <class SVC_HANDLER, class SYNC_POLICY, class ALLOCATOR> NINA_INLINE NINAHandle
+DatagramAcceptor<SVC_HANDLER, SYNC_POLICY, ALLOCATOR>::getHandle() const
+{
+	return mSock.getHandle();
+}
+
+template <class SVC_HANDLER, class SYNC_POLICY, class ALLOCATOR> NINA_INLINE void
+DatagramAcceptor<SVC_HANDLER, SYNC_POLICY, ALLOCATOR>::setIdleTimeout(Time const& timeout)
+{
+	mIdleTimeout = timeout;
+}
+
+template <class SVC_HANDLER, class SYNC_POLICY, class ALLOCATOR> NINA_INLINE SVC_HANDLER*
+DatagramAcceptor<SVC_HANDLER, SYNC_POLICY, ALLOCATOR>::getSession(_Addr const& addr)
+{
+	InetAddrKey		key(addr);
+	SVC_HANDLER**	session = mSessions.find(key);
+
+	return (session != 0 ? *session : 0);
+}
+
+template <class SVC_HANDLER, class SYNC_POLICY, class ALLOCATOR> NINA_INLINE size_t
+DatagramAcceptor<SVC_HANDLER, SYNC_POLICY, ALLOCATOR>::getSessionCount() const
+{
+	return mSessions.size();
+}
+
+template <class SVC_HANDLER, class SYNC_POLICY, class ALLOCATOR> NINA_INLINE SockDatagram&
+DatagramAcceptor<SVC_HANDLER, SYNC_POLICY, ALLOCATOR>::getSocket()
+{
+	return mSock;
+}
+
+template <class SVC_HANDLER, class SYNC_POLICY, class ALLOCATOR> NINA_INLINE ALLOCATOR&
+DatagramAcceptor<SVC_HANDLER, SYNC_POLICY, ALLOCATOR>::getAllocator()
+{
+	return mAllocator;
+}
+
+template <class SVC_HANDLER, class SYNC_POLICY, class ALLOCATOR> NINA_INLINE SVC_HANDLER*
+DatagramAcceptor<SVC_HANDLER, SYNC_POLICY, ALLOCATOR>::makeServiceHandler() const
+{
+	return mAllocator.allocate();
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,137 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaDatagramBatch.hpp
+ * @brief Defines the batches of received datagrams of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_DATAGRAMBATCH_HPP__
+# define __NINA_DATAGRAMBATCH_HPP__
+
+# include "NinaDef.hpp"
+
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251)
+# endif // !NINA_WIN32
+
+# if defined (NINA_POSIX)
+#  include <sys/socket.h>
+#  include <sys/uio.h>
+# endif // !NINA_POSIX
+
+# include <vector>
+# include "NinaOS.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class DatagramBatch
+ * @brief Buffers receiving several datagrams at once
+ *
+ * @details A batch holds a fixed number of buffers of the same size along with the address of their sender.
+ * It is filled by SockDatagram::receiveBatch, with a single system call where recvmmsg is available
+ * (see #NINA_HAS_RECVMMSG), one datagram per call otherwise.<br/>
+ * The buffers are allocated once at construction, thus a batch is meant to be reused across receptions
+ */
+class NINA_DLLREQ DatagramBatch
+{
+	friend int OS::recvBatch(NINAHandle sock, DatagramBatch& batch, int flags);
+
+	public:
+		enum
+		{
+			DEFAULT_CAPACITY = 32, //!< Default number of datagrams per batch
+			DEFAULT_DATAGRAM_SIZE = 2048 //!< Default size of the buffers
+		};
+
+	public:
+		/*!
+		 * @brief Constructor
+		 * @param[in] capacity : maximum number of datagrams received at once (at least one)
+		 * @param[in] datagramSize : size of each buffer, larger datagrams are truncated
+		 */
+		explicit DatagramBatch(size_t capacity = DEFAULT_CAPACITY, size_t datagramSize = DEFAULT_DATAGRAM_SIZE);
+		//! @brief Destructor
+		~DatagramBatch();
+		//! @brief Copy constructor (the datagrams received are not copied)
+		DatagramBatch(DatagramBatch const& batch);
+		//! @brief Assignement operator (the datagrams received are not copied)
+		DatagramBatch& operator=(DatagramBatch const& batch);
+
+	private:
+		//! Size of the ancillary data buffer of each datagram (packet info and timestamps)
+		enum { CONTROL_SIZE = 128 };
+
+	public:
+		//! @brief Get the number of datagrams received by the last reception
+		size_t getCount() const;
+		//! @brief Get the maximum number of datagrams received at once
+		size_t getCapacity() const;
+		//! @brief Get the size of the buffers
+		size_t getDatagramSize() const;
+		//! @brief Get the content of a datagram
+		char const* getData(size_t idx) const;
+		//! @brief Get the number of bytes of a datagram
+		size_t getSize(size_t idx) const;
+		//! @brief Get the address of the sender of a datagram (a sockaddr structure)
+		void const* getAddr(size_t idx) const;
+		//! @brief Get the size of the address of the sender of a datagram
+		int getAddrLen(size_t idx) const;
+		/*!
+		 * @brief Get the address a datagram was sent to, such as its multicast group (a sockaddr structure without port)
+		 * @details It is only reported once enabled on the socket (see SockDatagram::setPacketInfo)
+		 * @return a pointer on the address or 0 if it was not reported
+		 */
+		void const* getDestAddr(size_t idx) const;
+		//! @brief Get the size of the address a datagram was sent to, 0 if it was not reported
+		int getDestAddrLen(size_t idx) const;
+		/*!
+		 * @brief Get the time the kernel received a datagram (a real time)
+		 * @details It is only reported once enabled on the socket (see SockIO::setTimestamping)
+		 * @return the timestamp or Time::timeNull if it was not reported
+		 */
+		Time const& getTimestamp(size_t idx) const;
+		//! @brief Forget the datagrams received
+		void clear();
+
+	private:
+		//! @brief Allocate the buffers and link the message headers to them
+		void allocate(size_t capacity, size_t datagramSize);
+
+	private:
+		std::vector<char>				mBuffer; //!< Storage of the datagrams, one slice per datagram
+		std::vector<sockaddr_storage>	mAddrs; //!< Addresses of the senders
+		std::vector<size_t>				mSizes; //!< Number of bytes of each datagram
+		std::vector<int>				mAddrLens; //!< Size of each address
+		std::vector<sockaddr_storage>	mDests; //!< Destination addresses
+		std::vector<int>				mDestLens; //!< Size of each destination address, 0 if not reported
+		std::vector<Time>				mStamps; //!< Receive timestamps of the kernel
+		size_t							mDatagramSize; //!< Size of each buffer
+		size_t							mCount; //!< Number of datagrams received
+# if defined (NINA_HAS_RECVMMSG)
+		std::vector<mmsghdr>			mHeaders; //!< Message headers handed to recvmmsg
+		std::vector<iovec>				mVectors; //!< I/O vectors of the message headers
+		std::vector<char>				mControls; //!< Ancillary data of the message headers
+# endif // !NINA_HAS_RECVMMSG
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaDatagramBatch.inl"
+
+#endif // !__NINA_DATAGRAMBATCH_HPP__
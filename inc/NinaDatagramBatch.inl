@@ -0,0 +1,90 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaDatagramBatch.inl
+ * @brief Implements the batches of received datagrams of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE size_t
+DatagramBatch::getCount() const
+{
+	return mCount;
+}
+
+NINA_INLINE size_t
+DatagramBatch::getCapacity() const
+{
+	return mSizes.size();
+}
+
+NINA_INLINE size_t
+DatagramBatch::getDatagramSize() const
+{
+	return mDatagramSize;
+}
+
+NINA_INLINE char const*
+DatagramBatch::getData(size_t idx) const
+{
+	return &mBuffer[idx * mDatagramSize];
+}
+
+NINA_INLINE size_t
+DatagramBatch::getSize(size_t idx) const
+{
+	return mSizes[idx];
+}
+
+NINA_INLINE void const*
+DatagramBatch::getAddr(size_t idx) const
+{
+	return &mAddrs[idx];
+}
+
+NINA_INLINE int
+DatagramBatch::getAddrLen(size_t idx) const
+{
+	return mAddrLens[idx];
+}
+
+NINA_INLINE void const*
+DatagramBatch::getDestAddr(size_t idx) const
+{
+	return (mDestLens[idx] > 0 ? &mDests[idx] : 0);
+}
+
+NINA_INLINE int
+DatagramBatch::getDestAddrLen(size_t idx) const
+{
+	return mDestLens[idx];
+}
+
+NINA_INLINE Time const&
+DatagramBatch::getTimestamp(size_t idx) const
+{
+	return mStamps[idx];
+}
+
+NINA_INLINE void
+DatagramBatch::clear()
+{
+	mCount = 0;
+}
+
+NINA_END_NAMESPACE_DECL
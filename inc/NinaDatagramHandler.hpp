@@ -0,0 +1,172 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaDatagramHandler.hpp
+ * @brief Defines the datagram sessions of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_DATAGRAMHANDLER_HPP__
+# define __NINA_DATAGRAMHANDLER_HPP__
+
+# include "NinaDef.hpp"
+# include "NinaEventHandler.hpp"
+# include "NinaSockDatagram.hpp"
+# include "NinaInetAddr.hpp"
+# include "NinaInetAddrKey.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class DatagramPeer
+ * @brief Endpoint of a datagram session
+ *
+ * @details A peer is made of the socket shared by all the sessions of a DatagramAcceptor and of the address
+ * of the remote entity, thus replies are sent through the shared socket.<br/>
+ * Closing a peer only detaches it from the shared socket, which is owned by the DatagramAcceptor
+ */
+class NINA_DLLREQ DatagramPeer
+{
+	public:
+		//! @brief Constructor, the peer is detached
+		DatagramPeer();
+		//! @brief Destructor
+		~DatagramPeer();
+		//! @brief Copy constructor
+		DatagramPeer(DatagramPeer const& peer);
+		//! @brief Assignement operator
+		DatagramPeer& operator=(DatagramPeer const& peer);
+
+	public:
+		/*!
+		 * @brief Attach the peer to a shared socket
+		 * @param[in] sock : the socket shared with the other sessions
+		 * @param[in] addr : the raw address of the remote entity (a sockaddr structure)
+		 * @param[in] addrLen : size of the address
+		 * @return 0 on success or -1 if the address is not an internet one
+		 */
+		int open(SockDatagram const* sock, void const* addr, int addrLen);
+		//! @brief Detach the peer from the shared socket, the socket itself stays open
+		void close();
+		/*!
+		 * @brief Send a datagram to the remote entity
+		 * @param[in] buf : buffer to be sent
+		 * @param[in] bufLen : size of the buffer
+		 * @param[in] flag : specify a mode to customize the sending, it can take the following flag : SockIO::DONT_ROUTE
+		 * @return The number of bytes sent on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int send(void const* buf, size_t bufLen, uint8_t flag = 0) const;
+		//! @brief Send a string to the remote entity (see send above)
+		int send(std::string const& str, uint8_t flag = 0) const;
+		//! @brief Get the handle of the shared socket or NINA_INVALID_HANDLE if detached
+		NINAHandle getHandle() const;
+		//! @brief Get the address of the remote entity
+		InetAddr& getAddr();
+		//! @brief Get the key of the remote entity address (see NINA::InetAddrKey)
+		InetAddrKey const& getKey() const;
+
+	private:
+		SockDatagram const*	mSock; //!< Socket shared with the other sessions
+		InetAddr			mAddr; //!< Address of the remote entity
+		InetAddrKey			mKey; //!< Key of the address of the remote entity
+};
+
+/*! @class DatagramHandler
+ * @brief An abstract class describing a service bound to a datagram peer
+ *
+ * @details This class is the datagram counterpart of the ServiceHandler: a DatagramAcceptor creates one handler
+ * per remote address on its first datagram, then routes it the following datagrams of this address
+ * (see DatagramHandler::handleDatagram).<br/>
+ * A session ends when handleDatagram reports an error or when it stays idle longer than the timeout
+ * of its DatagramAcceptor (see EventHandler::handleIdle), handleClose is then called and the handler is destroyed
+ */
+class NINA_DLLREQ DatagramHandler : public EventHandler
+{
+	public:
+		/*! @class Owner
+		 * @brief Table holding the sessions (see NINA::DatagramAcceptor)
+		 */
+		class Owner
+		{
+			public:
+				//! @brief Virtual destructor
+				virtual ~Owner() {};
+				//! @brief Remove a session from the table then destroy it
+				virtual void release(DatagramHandler* handler) = 0;
+		};
+
+	public:
+		//! @brief Virtual destructor
+		virtual ~DatagramHandler() {};
+	protected:
+		//! @brief Constructor
+		DatagramHandler();
+		//! @brief Copy constructor
+		DatagramHandler(DatagramHandler const& handler);
+		//! @brief Assignement operator
+		DatagramHandler& operator=(DatagramHandler const& handler);
+
+	public:
+		virtual int handleRead(NINAHandle) {return 0;};
+		virtual int handleWrite(NINAHandle) {return 0;};
+		virtual int handleUrgent(NINAHandle) {return 0;};
+		virtual int handleTimeout(NINAHandle) {return 0;};
+		virtual int handleSignal(NINAHandle) {return 0;};
+		/*!
+		 * @brief Handle the end of the session, the handler is removed from its DatagramAcceptor then destroyed
+		 * @remark Overriding functions must call DatagramHandler::handleClose last
+		 */
+		virtual int handleClose(NINAHandle);
+		//! @brief Get the handle of the shared socket
+		virtual NINAHandle getHandle() const;
+		/*!
+		 * @brief Initialize the session
+		 * @details This function is called on the first datagram of a new peer, before it is handed to handleDatagram
+		 * @return 0 on success, -1 on error in which case the datagram is dropped and the handler destroyed
+		 */
+		virtual int init() = 0;
+		/*!
+		 * @brief Handle a datagram of the peer
+		 * @param[in] data : the content of the datagram, only valid during the call
+		 * @param[in] len : the number of bytes of the datagram
+		 * @return 0 on success or -1 to end the session
+		 */
+		virtual int handleDatagram(char const* data, size_t len) = 0;
+		/*!
+		 * @brief Destroy the session
+		 * @details Sessions must be destroyed through this function rather than deleted, so that the allocator
+		 * of the DatagramAcceptor may recycle them (see NINA::RecycleAllocator). By default the session is deleted
+		 */
+		virtual void destroy() {delete this;};
+		//! @brief Reset the session before it is recycled (see ServiceHandler::reset)
+		virtual void reset() {};
+		//! @brief Get the endpoint of the session
+		DatagramPeer& getPeer();
+		//! @brief Get the address of the peer
+		InetAddr& getRemoteAddr();
+		//! @brief Set the table holding the session, it is notified once the session ends (see handleClose)
+		void setOwner(Owner* owner);
+
+	private:
+		DatagramPeer	mPeer; //!< Endpoint of the session
+		Owner*			mOwner; //!< Table holding the session
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaDatagramHandler.inl"
+
+#endif // !__NINA_DATAGRAMHANDLER_HPP__
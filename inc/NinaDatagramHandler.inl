@@ -0,0 +1,78 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaDatagramHandler.inl
+ * @brief Implements the datagram sessions of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE void
+DatagramPeer::close()
+{
+	mSock = 0;
+}
+
+NINA_INLINE int
+DatagramPeer::send(std::string const& str, uint8_t flag) const
+{
+	return send(str.c_str(), str.size(), flag);
+}
+
+NINA_INLINE NINAHandle
+DatagramPeer::getHandle() const
+{
+	return (mSock != 0 ? mSock->getHandle() : NINA_INVALID_HANDLE);
+}
+
+NINA_INLINE InetAddr&
+DatagramPeer::getAddr()
+{
+	return mAddr;
+}
+
+NINA_INLINE InetAddrKey const&
+DatagramPeer::getKey() const
+{
+	return mKey;
+}
+
+NINA_INLINE NINAHandle
+DatagramHandler::getHandle() const
+{
+	return mPeer.getHandle();
+}
+
+NINA_INLINE DatagramPeer&
+DatagramHandler::getPeer()
+{
+	return mPeer;
+}
+
+NINA_INLINE InetAddr&
+DatagramHandler::getRemoteAddr()
+{
+	return mPeer.getAddr();
+}
+
+NINA_INLINE void
+DatagramHandler::setOwner(Owner* owner)
+{
+	mOwner = owner;
+}
+
+NINA_END_NAMESPACE_DECL
@@ -63,9 +63,15 @@
 
 # include "NinaTypes.hpp" // version < MSVC++ 10.0
 
+//! Build a 64-bit constant from its 32-bit halves, long long literals are not part of ISO C++98
+# define NINA_UINT64_C(high, low) (((uint64_t)(high) << 32) | (uint64_t)(low))
+
 # if BYTE_ORDER == BIG_ENDIAN
 #  define HTONLL(x) (x)
 #  define NTOHLL(x) (x)
+# elif defined (__GNUC__)
+#  define HTONLL(x) __builtin_bswap64(x)
+#  define NTOHLL(x) HTONLL(x)
 # else
 #  define HTONLL(x) ((((uint64_t)(x) & 0xFFULL) << 56) | \
 		(((uint64_t)(x) & 0xFF00ULL) << 40) | \
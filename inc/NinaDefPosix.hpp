@@ -70,10 +70,19 @@
 //! Defines whether or not `entdata` buffers are used into inet reentrant functions
 //! @def NINA_HAS_EPOLL
 //! Defines that the synchroneous event demultiplexer `epoll` is available on the OS
+//! @def NINA_HAS_ACCEPT4
+//! Defines that accept4 is available, allowing to set the accepted handle options atomically
+//! @def NINA_HAS_RECVMMSG
+//! Defines that recvmmsg is available, allowing to receive several datagrams with a single system call
+//! @def NINA_HAS_TIMESTAMPING
+//! Defines that the kernel reports the software timestamps of the sockets (SO_TIMESTAMPING)
 #  if defined (__linux__)
 #	define NINA_LINUX
 #   define NINA_LACK_OF_ENTDATA
 #   define NINA_HAS_EPOLL
+#   define NINA_HAS_ACCEPT4
+#   define NINA_HAS_RECVMMSG
+#   define NINA_HAS_TIMESTAMPING
 #  endif // !__linux__
 
 //! @def NINA_HAS_KQUEUE
@@ -83,6 +92,22 @@
 #   define NINA_HAS_KQUEUE
 #  endif // !__FreeBSD__ || __NetBSD__ || __OpenBSD__ || __bsdi__ || __DragonFly__
 
+//! @def NINA_HAS_REUSEPORT
+//! Defines whether or not several sockets can be bound on the same address and port
+#  if defined (__linux__) || defined (__FreeBSD__) || defined (__NetBSD__) || defined (__OpenBSD__) || defined (__DragonFly__)
+#   define NINA_HAS_REUSEPORT
+#  endif // !__linux__ || __FreeBSD__ || __NetBSD__ || __OpenBSD__ || __DragonFly__
+
+//! @def NINA_THREAD_LOCAL
+//! Defines the storage class of thread local variables
+#  define NINA_THREAD_LOCAL __thread
+
+//! @def NINA_HAS_TSC
+//! Defines that the time stamp counter of the processor can be read (see NINA::TSCClock)
+#  if defined (__GNUC__) && (defined (__i386__) || defined (__x86_64__))
+#   define NINA_HAS_TSC
+#  endif // !__GNUC__ && (__i386__ || __x86_64__)
+
 //! @def INFTIM
 //! Defines INFTIM if not set
 #  if !defined (INFTIM)
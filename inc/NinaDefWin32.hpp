@@ -57,6 +57,10 @@
 #   define NINA_EXTERN extern
 #  endif // !NINA_DLLEXPORT
 
+//! @def NINA_THREAD_LOCAL
+//! Defines the storage class of thread local variables
+#  define NINA_THREAD_LOCAL __declspec(thread)
+
 //! @name Defines used to shutdown a connection
 //! @{
 #  define NINA_SHUT_READ SD_RECEIVE
@@ -55,11 +55,27 @@ class NINA_DLLREQ EpollPolicy : public ReactorImplement, public NonCopyable
 		virtual int removeHandler(NINAHandle handle, uint16_t eType);
 		//! @brief Process to the event handling
 		virtual int handleEvents(Time const* timeout = 0);
+		//! @brief Get the precision of the timeouts, waits are exact to the nanosecond (see EpollPolicy::wait)
+		virtual int64_t getTimeoutPrecision() const;
+
+	private:
+		/*!
+		 * @brief Wait for the events
+		 * @details Timeouts made of whole milliseconds are given to epoll_wait. Otherwise epoll_pwait2 is used,
+		 * or if the kernel does not support it, a timerfd armed with the exact timeout is watched along
+		 * with the handles
+		 * @return the number of events stored in mFdSet or -1 on error
+		 */
+		int wait(Time const* timeout);
+		//! @brief Wait for the events until the timerfd expires
+		int waitTimer(Time const& timeout);
 
 	private:
 		int				mFdQueue; //!< Queue of handles
 		epoll_event		*mFdSet; //!< Epoll specifics data
 		long			mOpenMax; //!< Maximum open file descriptors
+		int				mTimerFd; //!< Timer of the sub-millisecond waits, created on demand
+		bool			mHasPwait2; //!< Whether the kernel supports epoll_pwait2
 };
 
 NINA_END_NAMESPACE_DECL
@@ -33,4 +33,10 @@ EpollPolicy::removeHandler(EventHandler* eHandler, uint16_t eType)
 	return removeHandler(eHandler->getHandle(), eType);
 }
 
+NINA_INLINE int64_t
+EpollPolicy::getTimeoutPrecision() const
+{
+	return 1;
+}
+
 NINA_END_NAMESPACE_DECL
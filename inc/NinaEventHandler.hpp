@@ -24,6 +24,7 @@
 
 # include "NinaTypes.hpp"
 # include "NinaCppUtils.hpp"
+# include "NinaTime.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
 
@@ -37,6 +38,8 @@ NINA_BEGIN_NAMESPACE_DECL
 class NINA_DLLREQ EventHandler
 {
 	protected:
+		//! @brief Constructor
+		EventHandler() : mLastActivity(0, 0) {}
 		//! @brief Virtual destructor
 		virtual ~EventHandler() {}
 
@@ -86,8 +89,39 @@ class NINA_DLLREQ EventHandler
 		 * special manipulations such as discarding subsequent events in order to avoid memory corruptions
 		 */
 		virtual int handleClose(NINAHandle handle) = 0;
+		/*!
+		 * @brief Handle the expiration of a timer (see Reactor::scheduleTimer)
+		 * @details The default implementation ignores the timer, its parameter is the identifier of the expired timer
+		 * @return 0 on success or -1 on error (see handleClose above)
+		 */
+		virtual int handleTimer(long) {return 0;};
+		/*!
+		 * @brief Handle the expiration of an idle timeout (see Reactor::trackIdle)
+		 * @details The default implementation reports an error, thus the EventHandler is closed
+		 * @return 0 to keep on tracking the EventHandler, 1 to stop tracking it or -1 on error (see handleClose above)
+		 */
+		virtual int handleIdle(NINAHandle) {return -1;};
+		/*!
+		 * @brief Handle the start of a drain (see Reactor::drain)
+		 * @details The EventHandler should stop taking new work, finish its current one (flushing its pending output)
+		 * then remove its events from the reactor. The default implementation closes it at once, which suits idle ones
+		 * @return 0 if the EventHandler removes its events later on, 1 if it has already removed them
+		 * or -1 to be removed and closed at once (see handleClose above)
+		 */
+		virtual int handleDrain(NINAHandle) {return -1;};
+		/*!
+		 * @brief Get the time of the last activity
+		 * @details The reactor stamps it each time a read, write or urgent event is dispatched, with a time
+		 * taken once per loop iteration (see Reactor::now)
+		 */
+		Time const& getLastActivity() const {return mLastActivity;};
+		//! @brief Set the time of the last activity (see getLastActivity above)
+		void setLastActivity(Time const& time) {mLastActivity = time;};
 		//! @brief Get the underlying handle used by the EventHandler
 		virtual NINAHandle getHandle() const = 0;
+
+	private:
+		Time	mLastActivity; //!< Time of the last event dispatched
 };
 
 NINA_END_NAMESPACE_DECL
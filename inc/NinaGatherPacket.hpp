@@ -0,0 +1,142 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaGatherPacket.hpp
+ * @brief Defines the scatter-gather output packets of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_GATHER_PACKET_HPP__
+# define __NINA_GATHER_PACKET_HPP__
+
+# include "NinaDef.hpp"
+# include "NinaPacket.hpp"
+# include "NinaIOContainer.hpp"
+
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251)
+# endif // !NINA_WIN32
+
+# include <deque>
+# include <vector>
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class GatherPacket
+ * @brief Marshalling for gather write operations
+ *
+ * @details This class provides the same operators as OutputPacket but never flattens large payloads:
+ * small fields are marshalled in inline header buffers while large blobs are only referenced.<br/>
+ * The result is handed to SockStream::gatherWrite through an IOContainer, thus large payloads reach
+ * the socket without any user space copy.<br/>
+ * The bytes sent are exactly the ones an OutputPacket would have produced (see GatherPacket::dump)
+ * @remark Referenced blobs must outlive the packet, or at least the write operation
+ */
+class NINA_DLLREQ GatherPacket
+{
+	public:
+		//! Default size from which strings are referenced instead of being copied
+		enum { DEFAULT_BLOB_THRESHOLD = 512 };
+
+	public:
+		/*!
+		 * @brief Constructor
+		 * @param[in] blobThreshold : size from which strings are referenced instead of being copied
+		 * @param[in] encoding : integer encoding of the packet (see NINA::CDR::Encoding)
+		 */
+		GatherPacket(size_t blobThreshold = DEFAULT_BLOB_THRESHOLD, CDR::Encoding encoding = CDR::FIXED_WIDTH);
+		//! @brief Virtual destructor
+		virtual ~GatherPacket() {};
+		//! @brief Copy constructor
+		GatherPacket(GatherPacket const& gpack);
+		//! @brief Assignement operator
+		GatherPacket& operator=(GatherPacket const& gpack);
+
+	public:
+		//! @brief Adds a boolean field to the packet
+		GatherPacket& operator<<(CDR::Boolean value);
+		//! @brief Adds a char field to the packet
+		GatherPacket& operator<<(CDR::Char value);
+		//! @brief Adds an unsigned char field to the packet
+		GatherPacket& operator<<(CDR::UChar value);
+		//! @brief Adds a short field to the packet
+		GatherPacket& operator<<(CDR::Short value);
+		//! @brief Adds an unsigned short field to the packet
+		GatherPacket& operator<<(CDR::UShort value);
+		//! @brief Adds an integer field to the packet
+		GatherPacket& operator<<(CDR::Integer value);
+		//! @brief Adds an unsigned integer field to the packet
+		GatherPacket& operator<<(CDR::UInteger value);
+		//! @brief Adds a long field to the packet
+		GatherPacket& operator<<(CDR::Long value);
+		//! @brief Adds an unsigned long field to the packet
+		GatherPacket& operator<<(CDR::ULong value);
+		/*!
+		 * @brief Adds a string field to the packet
+		 * @details Strings larger than the blob threshold are referenced, thus they must not be
+		 * modified nor destroyed until the packet is written
+		 */
+		GatherPacket& operator<<(CDR::String const& str);
+		/*!
+		 * @brief Adds a reference on raw bytes to the packet, whatever their size
+		 * @param[in] data : bytes to reference (they must outlive the write operation)
+		 * @param[in] len : number of bytes
+		 */
+		GatherPacket& reference(char const* data, size_t len);
+		/*!
+		 * @brief Append the packet segments to an IOContainer
+		 * @details The container is then ready for SockStream::gatherWrite
+		 * @param[out] ioc : the container to fill
+		 */
+		void fill(IOContainer& ioc) const;
+		//! @brief Get the number of bytes of the packet
+		size_t getSize() const;
+		//! @brief Dump the packet in an unformatted string (this flattens the packet)
+		//! @return a copy of the packet in a string format
+		std::string dump() const;
+		//! @brief Clear the packet, destroying all of its content
+		void clear();
+		//! @brief Set the byte order of the fixed width integers added afterwards (see OutputPacket::setByteOrder)
+		void setByteOrder(CDR::ByteOrder byteOrder);
+
+	private:
+		//! @brief Get the header buffer receiving the next inline fields
+		OutputPacket& getHeader();
+
+	private:
+		//! Segment of the packet, either a header buffer or a referenced blob
+		struct Segment
+		{
+			bool		isBlob; //!< Whether the segment references a blob
+			size_t		header; //!< Index of the header buffer if not a blob
+			char const*	data; //!< Referenced blob
+			size_t		len; //!< Size of the referenced blob
+		};
+
+		std::deque<OutputPacket>	mHeaders; //!< Inline header buffers
+		std::vector<Segment>		mSegments; //!< Ordered segments of the packet
+		size_t						mBlobThreshold; //!< Size from which strings are referenced
+		CDR::Encoding				mEncoding; //!< Integer encoding
+		CDR::ByteOrder				mByteOrder; //!< Byte order of the fixed width integers
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaGatherPacket.inl"
+
+#endif /* !__NINA_GATHER_PACKET_HPP__ */
@@ -0,0 +1,134 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaGatherPacket.inl
+ * @brief Implements the scatter-gather output packets of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE OutputPacket&
+GatherPacket::getHeader()
+{
+	if (mSegments.empty() || mSegments.back().isBlob) {
+		Segment segment = {false, mHeaders.size(), 0, 0};
+
+		mHeaders.push_back(OutputPacket("", mEncoding));
+		mHeaders.back().setByteOrder(mByteOrder);
+		mSegments.push_back(segment);
+	}
+	return mHeaders.back();
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::Boolean value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::Char value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::UChar value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::Short value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::UShort value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::Integer value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::UInteger value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::Long value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::ULong value)
+{
+	getHeader() << value;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::operator<<(CDR::String const& str)
+{
+	if (str.size() >= mBlobThreshold)
+		return reference(str.data(), str.size());
+	getHeader() << str;
+	return *this;
+}
+
+NINA_INLINE GatherPacket&
+GatherPacket::reference(char const* data, size_t len)
+{
+	Segment segment = {true, 0, data, len};
+
+	if (len > 0)
+		mSegments.push_back(segment);
+	return *this;
+}
+
+NINA_INLINE void
+GatherPacket::clear()
+{
+	mHeaders.clear();
+	mSegments.clear();
+}
+
+NINA_INLINE void
+GatherPacket::setByteOrder(CDR::ByteOrder byteOrder)
+{
+	mByteOrder = byteOrder;
+	if (mSegments.empty() == false && mSegments.back().isBlob == false)
+		mHeaders.back().setByteOrder(byteOrder);
+}
+
+NINA_END_NAMESPACE_DECL
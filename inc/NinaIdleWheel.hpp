@@ -0,0 +1,131 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaIdleWheel.hpp
+ * @brief Defines the idle timeout wheel of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_IDLEWHEEL_HPP__
+# define __NINA_IDLEWHEEL_HPP__
+
+# include "NinaDef.hpp"
+
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251)
+# endif // !NINA_WIN32
+
+# include <map>
+# include <vector>
+# include <utility>
+# include "NinaTypes.hpp"
+# include "NinaCppUtils.hpp"
+# include "NinaTime.hpp"
+# include "NinaEventHandler.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class IdleWheel
+ * @brief Coarse idle timeouts of EventHandlers
+ *
+ * @details This class is used by NINA::Reactor to detect the EventHandlers which have not been active
+ * for a given time (see EventHandler::getLastActivity)<br/>
+ * The EventHandlers are spread over a ring of slots, each one covering a granularity of time. The activity
+ * of an EventHandler never moves it: a slot is only visited once its time elapsed, then its EventHandlers
+ * which are still active are moved to the slot of their new deadline and the others are notified through
+ * EventHandler::handleIdle<br/>
+ * Thus, an active EventHandler costs one move per timeout period whatever its number of events, and a tick
+ * only visits a single slot
+ */
+class NINA_DLLREQ IdleWheel : public NonCopyable
+{
+	public:
+		//! Default number of slots of the wheel
+		enum { DEFAULT_SLOTS = 64 };
+
+	private:
+		//! Idle timeout of a tracked EventHandler and its generation, identifying its entry in the slots
+		typedef std::pair<Time, unsigned long> Tracked;
+		//! Tracked EventHandlers
+		typedef std::map<EventHandler*, Tracked> TrackTable;
+		//! Entry of a slot, obsolete if its generation differs from the tracked one
+		typedef std::pair<EventHandler*, unsigned long> Entry;
+		//! A slot of the wheel
+		typedef std::vector<Entry> Slot;
+
+	public:
+		/*!
+		 * @brief Constructor
+		 * @param[in] granularity : time covered by a slot, namely the precision of the timeouts
+		 * @param[in] slots : number of slots, timeouts longer than a revolution are moved until they expire
+		 */
+		IdleWheel(Time const& granularity = Time(1, 0), size_t slots = DEFAULT_SLOTS);
+		//! @brief Destructor
+		~IdleWheel();
+
+	public:
+		/*!
+		 * @brief Track an EventHandler, or update its timeout if already tracked
+		 * @param[in] eHandler : EventHandler notified through EventHandler::handleIdle
+		 * @param[in] timeout : time of inactivity after which the EventHandler is notified
+		 * @param[in] now : the current time, used as its last activity
+		 * @return 0 on success or -1 on error
+		 */
+		int track(EventHandler* eHandler, Time const& timeout, Time const& now);
+		/*!
+		 * @brief Stop tracking an EventHandler
+		 * @return 0 on success or -1 if the EventHandler is not tracked
+		 */
+		int untrack(EventHandler* eHandler);
+		/*!
+		 * @brief Visit the slots which time elapsed
+		 * @details If EventHandler::handleIdle returns -1, EventHandler::handleClose is called
+		 * @param[in] now : the current time
+		 * @return the number of EventHandlers notified
+		 */
+		size_t expire(Time const& now);
+		/*!
+		 * @brief Set the time covered by a slot
+		 * @return 0 on success or -1 if EventHandlers are tracked
+		 */
+		int setGranularity(Time const& granularity);
+		//! @brief Check whether there are tracked EventHandlers
+		bool isEmpty() const;
+		//! @brief Get the number of tracked EventHandlers
+		size_t getTrackedCount() const;
+		//! @brief Get the time of the next tick (the wheel must not be empty)
+		Time getNextDeadline() const;
+
+	private:
+		//! @brief Put an EventHandler in the slot of its deadline
+		void insert(Entry const& entry, Time const& deadline);
+
+	private:
+		TrackTable			mTracked; //!< Tracked EventHandlers
+		std::vector<Slot>	mSlots; //!< Ring of slots
+		Time				mGranularity; //!< Time covered by a slot
+		Time				mBase; //!< Time at which the current slot began
+		size_t				mCursor; //!< Index of the current slot
+		unsigned long		mGeneration; //!< Generation of the next tracked EventHandler
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaIdleWheel.inl"
+
+#endif /* !__NINA_IDLEWHEEL_HPP__ */
@@ -87,6 +87,8 @@ class NINA_DLLREQ InetAddr : public Addr
 		bool operator==(InetAddr const& sap) const;
 		//! @brief Check for address inequality
 		bool operator!=(InetAddr const& sap) const;
+		//! @brief Strict ordering of the addresses, consistent with the equality (allows to key associative containers)
+		bool operator<(InetAddr const& sap) const;
 		//! @brief Get a pointer on the concrete address
 		//! @return A pointer on the concrete address or 0 on error
 		virtual void const* getAddr() const;
@@ -260,6 +262,10 @@ class NINA_DLLREQ InetAddr : public Addr
 		bool hasIpv4Addr() const;
 		//! @brief Test whether the address is an ipv6 address or not
 		bool hasIpv6Addr() const;
+		//! @brief Test whether the address is a loopback address (127.0.0.0/8 or ::1) or not
+		bool isLoopback() const;
+		//! @brief Test whether the address is a multicast address (224.0.0.0/4 or ff00::/8) or not
+		bool isMulticast() const;
 		//! @name Designed only for ipv6 addresses
 		//! @{
 
@@ -283,10 +289,6 @@ class NINA_DLLREQ InetAddr : public Addr
 		 * @warning Here errno may vary depending on the operating systems, but note that if it failed it's mainly that the interface doesn't exist
 		 */
 		int setScopeId(std::string const& ifaceName);
-		//! @brief Test whether the address is a loopback address or not
-		bool isLoopback() const;
-		//! @brief Test whether the address is a multicast address or not
-		bool isMulticast() const;
 		//! @brief Test whether the address is a link local address or not
 		bool isLinkLocal() const;
 		//! @brief Test whether the address is an ipv4 mapped address or not
@@ -39,6 +39,14 @@ InetAddr::operator!=(InetAddr const& sap) const
 	return false;
 }
 
+NINA_INLINE bool
+InetAddr::operator<(InetAddr const& sap) const
+{
+	if (::memcmp(&mInetAddr, &sap.mInetAddr, sizeof mInetAddr) < 0)
+		return true;
+	return false;
+}
+
 NINA_INLINE void const*
 InetAddr::getAddr() const
 {
@@ -102,6 +110,10 @@ InetAddr::hasIpv6Addr() const
 NINA_INLINE bool
 InetAddr::isLoopback() const
 {
+	if (hasIpv4Addr()) {
+		sockaddr_in const* sa = reinterpret_cast<sockaddr_in const*> (&mInetAddr);
+		return (ntohl(sa->sin_addr.s_addr) >> 24) == IN_LOOPBACKNET;
+	}
 	if (mFamily == AF_INET6
 				|| (mFamily == AF_UNSPEC && hasIpv6Addr())) {
 		sockaddr_in6 const* sa = reinterpret_cast<sockaddr_in6 const*> (&mInetAddr);
@@ -114,6 +126,10 @@ InetAddr::isLoopback() const
 NINA_INLINE bool
 InetAddr::isMulticast() const
 {
+	if (hasIpv4Addr()) {
+		sockaddr_in const* sa = reinterpret_cast<sockaddr_in const*> (&mInetAddr);
+		return IN_MULTICAST(ntohl(sa->sin_addr.s_addr)) != 0;
+	}
 	if (mFamily == AF_INET6
 				|| (mFamily == AF_UNSPEC && hasIpv6Addr())) {
 		sockaddr_in6 const* sa = reinterpret_cast<sockaddr_in6 const*> (&mInetAddr);
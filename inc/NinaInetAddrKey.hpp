@@ -0,0 +1,89 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaInetAddrKey.hpp
+ * @brief Defines the hashable keys of the internet domain addresses
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_INETADDRKEY_HPP__
+# define __NINA_INETADDRKEY_HPP__
+
+# include "NinaDef.hpp"
+# include "NinaInetAddr.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class InetAddrKey
+ * @brief Compact and normalized form of an internet address, meant to key hash tables
+ *
+ * @details A key is made of three 64-bit words: the 16 bytes of the address, then the family, the port and the
+ * scope id. IPv4 addresses are folded into their IPv4-mapped IPv6 form, thus a peer gets the same key whether it
+ * is received on an IPv4 socket or on a dual stack IPv6 one.<br/>
+ * Comparisons and hashing work on the words without any branch, making a lookup per datagram affordable
+ * (see NINA::InetAddrMap)
+ */
+class NINA_DLLREQ InetAddrKey
+{
+	public:
+		//! @brief Constructor, the key is null (it matches no address)
+		InetAddrKey();
+		//! @brief Constructor, from an internet address
+		explicit InetAddrKey(InetAddr const& addr);
+		//! @brief Destructor
+		~InetAddrKey() {};
+		//! @brief Copy constructor
+		InetAddrKey(InetAddrKey const& key);
+		//! @brief Assignement operator
+		InetAddrKey& operator=(InetAddrKey const& key);
+
+	public:
+		/*!
+		 * @brief Set the key from a raw socket address
+		 * @param[in] addr : a sockaddr_in or sockaddr_in6 structure
+		 * @param[in] addrLen : size of the structure
+		 * @return 0 on success or -1 if the address is not an internet one (the key is then null)
+		 */
+		int set(void const* addr, size_t addrLen);
+		//! @brief Set the key from an internet address
+		//! @return 0 on success or -1 if the address is not set (the key is then null)
+		int set(InetAddr const& addr);
+		//! @brief Check for key equality
+		bool operator==(InetAddrKey const& key) const;
+		//! @brief Check for key inequality
+		bool operator!=(InetAddrKey const& key) const;
+		//! @brief Order the keys (the order is stable but meaningless)
+		bool operator<(InetAddrKey const& key) const;
+		//! @brief Get the hash of the key
+		uint32_t getHash() const;
+		//! @brief Get the normalized family, AF_INET for IPv4 and IPv4-mapped addresses or 0 for a null key
+		int getFamily() const;
+		//! @brief Get the port in host byte order
+		uint16_t getPort() const;
+		//! @brief Get the scope id (0 apart from the scoped IPv6 addresses)
+		uint32_t getScopeId() const;
+		//! @brief Check whether the key is null
+		bool isNull() const;
+
+	private:
+		uint64_t	mWords[3]; //!< Address, then family, port and scope id
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaInetAddrKey.inl"
+
+#endif // !__NINA_INETADDRKEY_HPP__
@@ -0,0 +1,113 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaInetAddrKey.inl
+ * @brief Implements the hashable keys of the internet domain addresses (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE
+InetAddrKey::InetAddrKey()
+{
+	mWords[0] = 0;
+	mWords[1] = 0;
+	mWords[2] = 0;
+}
+
+NINA_INLINE
+InetAddrKey::InetAddrKey(InetAddrKey const& key)
+{
+	mWords[0] = key.mWords[0];
+	mWords[1] = key.mWords[1];
+	mWords[2] = key.mWords[2];
+}
+
+NINA_INLINE InetAddrKey&
+InetAddrKey::operator=(InetAddrKey const& key)
+{
+	mWords[0] = key.mWords[0];
+	mWords[1] = key.mWords[1];
+	mWords[2] = key.mWords[2];
+	return *this;
+}
+
+NINA_INLINE bool
+InetAddrKey::operator==(InetAddrKey const& key) const
+{
+	return ((mWords[0] ^ key.mWords[0]) | (mWords[1] ^ key.mWords[1]) | (mWords[2] ^ key.mWords[2])) == 0;
+}
+
+NINA_INLINE bool
+InetAddrKey::operator!=(InetAddrKey const& key) const
+{
+	return !(*this == key);
+}
+
+NINA_INLINE bool
+InetAddrKey::operator<(InetAddrKey const& key) const
+{
+	if (mWords[0] != key.mWords[0])
+		return mWords[0] < key.mWords[0];
+	if (mWords[1] != key.mWords[1])
+		return mWords[1] < key.mWords[1];
+	return mWords[2] < key.mWords[2];
+}
+
+// Mixes the words with the finalizer of splitmix64, each bit of the key reaches every bit of the hash
+NINA_INLINE uint32_t
+InetAddrKey::getHash() const
+{
+	uint64_t	h;
+
+	h = (mWords[0] ^ NINA_UINT64_C(0x9E3779B9, 0x7F4A7C15)) * NINA_UINT64_C(0xBF58476D, 0x1CE4E5B9);
+	h = (h ^ (h >> 31) ^ mWords[1]) * NINA_UINT64_C(0x94D049BB, 0x133111EB);
+	h = (h ^ (h >> 29) ^ mWords[2]) * NINA_UINT64_C(0xBF58476D, 0x1CE4E5B9);
+	return static_cast<uint32_t> (h ^ (h >> 32));
+}
+
+NINA_INLINE int
+InetAddrKey::getFamily() const
+{
+	return static_cast<int> (mWords[2] >> 48);
+}
+
+NINA_INLINE uint16_t
+InetAddrKey::getPort() const
+{
+	return static_cast<uint16_t> (mWords[2] >> 32);
+}
+
+NINA_INLINE uint32_t
+InetAddrKey::getScopeId() const
+{
+	return static_cast<uint32_t> (mWords[2]);
+}
+
+NINA_INLINE bool
+InetAddrKey::isNull() const
+{
+	return mWords[2] == 0 && mWords[0] == 0 && mWords[1] == 0;
+}
+
+NINA_INLINE int
+InetAddrKey::set(InetAddr const& addr)
+{
+	return set(addr.getAddr(), addr.getSize() < 0 ? 0 : addr.getSize());
+}
+
+NINA_END_NAMESPACE_DECL
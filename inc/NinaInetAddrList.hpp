@@ -0,0 +1,110 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaInetAddrList.hpp
+ * @brief Defines the multiple results of an internet domain address resolution
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_INETADDRLIST_HPP__
+# define __NINA_INETADDRLIST_HPP__
+
+# include "NinaDef.hpp"
+
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251 4275)
+# endif // !NINA_WIN32
+
+# include <string>
+# include <vector>
+# include "NinaInetAddr.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class InetAddrList
+ * @brief All the addresses a remote host resolves to
+ *
+ * @details Unlike InetAddr::remoteQuery which only keeps the first result of the resolution, this class keeps
+ * every address returned by the operating system, without duplicates<br/>
+ * The addresses are reordered so that the address families alternate, starting with the family of the first
+ * result (RFC 8305 section 4): an unreachable family only delays the connection by one attempt.<br/>
+ * The list is intended to be raced by Connector::connect
+ */
+class NINA_DLLREQ InetAddrList : public std::vector<InetAddr>
+{
+	public:
+		/*! @brief Constructor
+		 * @details Constructor of the class InetAddrList, the list is empty
+		 * @param[in] family : the address family to resolve, types supported are AF_INET/AF_INET6/AF_UNSPEC
+		 * @throw std::invalid_argument if the address family is unknown or not supported
+		 */
+		InetAddrList(int family = AF_UNSPEC);
+		//! @brief Destructor
+		~InetAddrList();
+		//! @brief Copy constructor
+		InetAddrList(InetAddrList const& list);
+		//! @brief Assignment operator
+		InetAddrList& operator=(InetAddrList const& list);
+
+	public:
+		/*! @brief Resolve all the addresses of a remote host, replacing the content of the list
+		 * @throw NINA::Error::SystemError if an error occured
+		 * @param[in] host : address of the remote host or FQDN if InetAddr::NAME_RESOLUTION is enabled
+		 * @param[in] port : port of the remote host or string service if InetAddr::SERV_RESOLUTION is enabled
+		 * @param[in] protocol : protocol used for the connection, IPPROTO_* or InetAddr::ANY_PROTO for a specific definiton by the operating system
+		 * @param[in] mode : specify the mode used to retreive the addresses (see InetAddr::remoteQuery)
+		 */
+		void remoteQuery(std::string const& host, std::string const& port,
+				int protocol, uint8_t mode = InetAddr::DEFAULT_MODE);
+		/*! @brief Resolve all the addresses of a remote host, replacing the content of the list
+		 * @throw NINA::Error::SystemError if an error occured
+		 * @param[in] host : address of the remote host or FQDN if InetAddr::NAME_RESOLUTION is enabled
+		 * @param[in] port : port of the remote host
+		 * @param[in] protocol : protocol used for the connection, IPPROTO_* or InetAddr::ANY_PROTO for a specific definiton by the operating system
+		 * @param[in] mode : specify the mode used to retreive the addresses (see InetAddr::remoteQuery)
+		 */
+		void remoteQuery(std::string const& host, uint16_t port,
+				int protocol, uint8_t mode = InetAddr::DEFAULT_MODE);
+		/*! @brief Resolve all the addresses of a remote host without throwing, replacing the content of the list
+		 * @param[in] host : address of the remote host or FQDN if InetAddr::NAME_RESOLUTION is enabled
+		 * @param[in] port : port of the remote host or string service if InetAddr::SERV_RESOLUTION is enabled
+		 * @param[in] protocol : protocol used for the connection, IPPROTO_* or InetAddr::ANY_PROTO for a specific definiton by the operating system
+		 * @param[in] mode : specify the mode used to retreive the addresses (see InetAddr::remoteQuery)
+		 * @return 0 on success or the error code of getaddrinfo (EAI_*, see gai_strerror)
+		 */
+		int resolve(std::string const& host, std::string const& port,
+				int protocol, uint8_t mode = InetAddr::DEFAULT_MODE);
+		/*!
+		 * @brief Force the socket type used for the connection
+		 * @details Calling this function must be done before any subsequent call to remoteQuery()
+		 * @param[in] sockType : socket type to use (SOCK_*)
+		 */
+		void forceSockType(int sockType);
+		//! @brief Get the address family resolved by the list
+		int getFamily() const;
+
+	private:
+		int		mFamily; //!< Address family to resolve
+		int		mForcedSockType; //!< Socket type requested
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaInetAddrList.inl"
+
+#endif // !__NINA_INETADDRLIST_HPP__
@@ -0,0 +1,131 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaInetAddrMap.hpp
+ * @brief Defines the hash table keyed by internet addresses
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_INETADDRMAP_HPP__
+# define __NINA_INETADDRMAP_HPP__
+
+# include "NinaDef.hpp"
+
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251)
+# endif // !NINA_WIN32
+
+# include <vector>
+# include "NinaInetAddrKey.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class InetAddrMap
+ * @brief Open addressing hash table keyed by internet addresses (see NINA::InetAddrKey)
+ *
+ * @details The entries are stored inline in a single array probed linearly, thus a lookup usually touches one
+ * cache line and never allocates. Erasing shifts the following entries back instead of leaving tombstones,
+ * so lookups do not slow down as peers come and go.<br/>
+ * The table doubles once three quarters of its slots are used
+ * @warning The pointers on the values are invalidated by the insertions and the removals
+ * @arg VALUE : the type of the values, it must be default constructible and assignable
+ */
+template <typename VALUE>
+class InetAddrMap
+{
+	public:
+		enum
+		{
+			DEFAULT_CAPACITY = 64 //!< Default number of slots
+		};
+
+	public:
+		/*!
+		 * @brief Constructor
+		 * @param[in] capacity : initial number of slots, rounded up to a power of two
+		 */
+		explicit InetAddrMap(size_t capacity = DEFAULT_CAPACITY);
+		//! @brief Destructor
+		~InetAddrMap();
+		//! @brief Copy constructor
+		InetAddrMap(InetAddrMap const& map);
+		//! @brief Assignement operator
+		InetAddrMap& operator=(InetAddrMap const& map);
+
+	public:
+		//! @brief Find the value of a key
+		//! @return a pointer on the value or 0 if the key is not in the table
+		VALUE* find(InetAddrKey const& key);
+		//! @brief Find the value of a key
+		//! @return a pointer on the value or 0 if the key is not in the table
+		VALUE const* find(InetAddrKey const& key) const;
+		/*!
+		 * @brief Insert a value if its key is not in the table yet
+		 * @param[in] key : the key of the value, it must not be null
+		 * @param[in] value : the value
+		 * @return a pointer on the value stored, the previous one if the key was in the table already, or 0 if the key is null
+		 */
+		VALUE* insert(InetAddrKey const& key, VALUE const& value);
+		//! @brief Get the value of a key, a default value is inserted if the key is not in the table (the key must not be null)
+		VALUE& operator[](InetAddrKey const& key);
+		//! @brief Remove a key from the table
+		//! @return true if the key was in the table
+		bool erase(InetAddrKey const& key);
+		//! @brief Remove every key from the table
+		void clear();
+		//! @brief Get the number of keys
+		size_t size() const;
+		//! @brief Check whether the table is empty
+		bool empty() const;
+		//! @brief Get the number of slots, the indexes walked to iterate over the table
+		size_t getCapacity() const;
+		//! @brief Get the key stored in a slot
+		//! @return a pointer on the key or 0 if the slot is free
+		InetAddrKey const* getKey(size_t slot) const;
+		//! @brief Get the value stored in a slot
+		//! @return a pointer on the value or 0 if the slot is free
+		VALUE* getValue(size_t slot);
+
+	private:
+		//! @brief Get the slot of a key, or the free slot ending its probe sequence
+		size_t probe(InetAddrKey const& key, uint32_t hash) const;
+		//! @brief Double the number of slots
+		void grow();
+
+	private:
+		//! Entry of the table
+		struct Slot
+		{
+			Slot() : hash(0), isUsed(false), value() {};
+
+			InetAddrKey	key; //!< Key of the entry
+			uint32_t	hash; //!< Hash of the key, kept to spare its computation while moving entries
+			bool		isUsed; //!< Whether the slot holds an entry
+			VALUE		value; //!< Value of the entry
+		};
+
+		std::vector<Slot>	mSlots; //!< Slots of the table, their number is a power of two
+		size_t				mMask; //!< Number of slots minus one
+		size_t				mSize; //!< Number of keys
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaInetAddrMap.imp"
+
+#endif // !__NINA_INETADDRMAP_HPP__
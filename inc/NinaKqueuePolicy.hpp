@@ -56,6 +56,8 @@ class NINA_DLLREQ KqueuePolicy : public ReactorImplement, public NonCopyable
 		virtual int removeHandler(NINAHandle handle, uint16_t eType);
 		//! @brief Process to the event handling
 		virtual int handleEvents(Time const* timeout = 0);
+		//! @brief Get the precision of the timeouts, kevent waits with a timespec
+		virtual int64_t getTimeoutPrecision() const {return 1;};
 
 	private:
 		int				mFdQueue; //!< Queue of handles
@@ -0,0 +1,102 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaLatencyHistogram.hpp
+ * @brief Defines the latency histogram of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_LATENCYHISTOGRAM_HPP__
+# define __NINA_LATENCYHISTOGRAM_HPP__
+
+# include "NinaDef.hpp"
+# include "NinaTypes.hpp"
+# include "NinaTime.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class LatencyHistogram
+ * @brief Distribution of latencies over logarithmic buckets
+ *
+ * @details The bucket n counts the latencies from 2^(n-1) included to 2^n nanoseconds excluded, the bucket 0
+ * the null ones. Recording a latency is thus a bit scan and an increment, with a relative precision
+ * of a factor two which is enough to tell a microsecond from a millisecond.<br/>
+ * It is used by NINA::Reactor to measure the time elapsed between the reception of the data by the kernel
+ * and the start of their handling (see Reactor::recordReceiveLatency)
+ */
+class NINA_DLLREQ LatencyHistogram
+{
+	public:
+		//! Number of buckets, enough for any latency held by a Time
+		enum { BUCKETS = 64 };
+
+	public:
+		//! @brief Constructor
+		LatencyHistogram();
+		//! @brief Destructor
+		~LatencyHistogram();
+		//! @brief Copy constructor
+		LatencyHistogram(LatencyHistogram const& histogram);
+		//! @brief Assignement operator
+		LatencyHistogram& operator=(LatencyHistogram const& histogram);
+
+	public:
+		//! @brief Record a latency, a negative one is recorded as null
+		void record(Time const& latency);
+		//! @brief Record a latency in nanoseconds, a negative one is recorded as null
+		void record(int64_t nSec);
+		//! @brief Add the latencies of another histogram, such as the one of another reactor
+		void merge(LatencyHistogram const& histogram);
+		//! @brief Forget the latencies recorded
+		void reset();
+		//! @brief Get the number of latencies recorded
+		uint64_t getCount() const;
+		//! @brief Get the number of latencies recorded in a bucket
+		uint64_t getBucket(size_t idx) const;
+		//! @brief Get the upper bound (excluded) of a bucket
+		static Time getBucketBound(size_t idx);
+		/*!
+		 * @brief Get a percentile of the latencies
+		 * @param[in] ratio : rank of the percentile, between 0 and 1 (0.99 for the 99th percentile)
+		 * @return the upper bound of the bucket holding the percentile, at most the maximum recorded
+		 * (Time::timeNull if no latency was recorded)
+		 */
+		Time getPercentile(double ratio) const;
+		//! @brief Get the lowest latency recorded (Time::timeNull if none)
+		Time getMin() const;
+		//! @brief Get the highest latency recorded (Time::timeNull if none)
+		Time getMax() const;
+		//! @brief Get the mean of the latencies recorded (Time::timeNull if none)
+		Time getMean() const;
+
+	private:
+		//! @brief Get the index of the bucket of a latency in nanoseconds
+		static size_t getBucketIndex(uint64_t nSec);
+
+	private:
+		uint64_t	mBuckets[BUCKETS]; //!< Number of latencies of each bucket
+		uint64_t	mCount; //!< Number of latencies recorded
+		int64_t		mSum; //!< Sum of the latencies in nanoseconds
+		int64_t		mMin; //!< Lowest latency in nanoseconds
+		int64_t		mMax; //!< Highest latency in nanoseconds
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaLatencyHistogram.inl"
+
+#endif /* !__NINA_LATENCYHISTOGRAM_HPP__ */
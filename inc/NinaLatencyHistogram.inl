@@ -0,0 +1,89 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaLatencyHistogram.inl
+ * @brief Implements the latency histogram of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE size_t
+LatencyHistogram::getBucketIndex(uint64_t nSec)
+{
+#if defined (__GNUC__)
+	return (nSec == 0 ? 0 : 64 - __builtin_clzll(nSec));
+#else
+	size_t	idx = 0;
+
+	for (; nSec != 0; nSec >>= 1)
+		++idx;
+	return idx;
+#endif // !__GNUC__
+}
+
+NINA_INLINE void
+LatencyHistogram::record(int64_t nSec)
+{
+	if (nSec < 0)
+		nSec = 0;
+	++mBuckets[getBucketIndex(nSec)];
+	if (mCount == 0 || nSec < mMin)
+		mMin = nSec;
+	if (mCount == 0 || nSec > mMax)
+		mMax = nSec;
+	++mCount;
+	mSum += nSec;
+}
+
+NINA_INLINE void
+LatencyHistogram::record(Time const& latency)
+{
+	record(latency.getNanoseconds());
+}
+
+NINA_INLINE uint64_t
+LatencyHistogram::getCount() const
+{
+	return mCount;
+}
+
+NINA_INLINE uint64_t
+LatencyHistogram::getBucket(size_t idx) const
+{
+	return (idx < BUCKETS ? mBuckets[idx] : 0);
+}
+
+NINA_INLINE Time
+LatencyHistogram::getMin() const
+{
+	return Time::fromNanoseconds(mMin);
+}
+
+NINA_INLINE Time
+LatencyHistogram::getMax() const
+{
+	return Time::fromNanoseconds(mMax);
+}
+
+NINA_INLINE Time
+LatencyHistogram::getMean() const
+{
+	return Time::fromNanoseconds(mCount == 0 ? 0 : mSum / static_cast<int64_t> (mCount));
+}
+
+NINA_END_NAMESPACE_DECL
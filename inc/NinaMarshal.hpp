@@ -0,0 +1,238 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaMarshal.hpp
+ * @brief Defines the compile-time structure marshalling of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_MARSHAL_HPP__
+# define __NINA_MARSHAL_HPP__
+
+# include "NinaDef.hpp"
+# include "NinaPacket.hpp"
+
+# include <cstring>
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @struct CDRTraits
+ * @brief Compile-time description of a CDR type (see NINA::CDR)
+ *
+ * @details Each specialization exposes FIXED (whether the encoded size is known at compile time),
+ * SIZE (the encoded size in bytes, 0 if not fixed) and the functions encoding it in a raw buffer
+ * or through a packet. The wire format is the same as the one of OutputPacket and InputPacket
+ * @arg TYPE : one of the NINA::CDR types
+ */
+template <typename TYPE>
+struct CDRTraits;
+
+/*! @struct CDRIntegralTraits
+ * @brief Common traits of the CDR integral types
+ * @arg TYPE : CDR integral type
+ * @arg NET_TYPE : unsigned type of the same size used to apply the byte ordering
+ */
+template <typename TYPE, typename NET_TYPE>
+struct CDRIntegralTraits
+{
+	enum {
+		FIXED = true,
+		SIZE = sizeof(TYPE)
+	};
+	//! @brief Encode a value in a raw buffer of at least SIZE bytes, swapping its bytes if SWAP is set
+	template <bool SWAP> static char* encode(char* buf, TYPE value);
+	//! @brief Decode a value from a raw buffer of at least SIZE bytes, swapping its bytes if SWAP is set
+	template <bool SWAP> static char const* decode(char const* buf, TYPE& value);
+	//! @brief Encode a value through an output packet
+	static void write(OutputPacket& opack, TYPE value);
+	//! @brief Decode a value through an input packet
+	static void read(InputPacket& ipack, TYPE& value);
+	//! @brief Size of the encoded value
+	static size_t size(TYPE) {return SIZE;};
+};
+
+//! @brief CDR::Char traits
+template <> struct CDRTraits<CDR::Char> : public CDRIntegralTraits<CDR::Char, uint8_t> {};
+//! @brief CDR::UChar traits
+template <> struct CDRTraits<CDR::UChar> : public CDRIntegralTraits<CDR::UChar, uint8_t> {};
+//! @brief CDR::Short traits
+template <> struct CDRTraits<CDR::Short> : public CDRIntegralTraits<CDR::Short, uint16_t> {};
+//! @brief CDR::UShort traits
+template <> struct CDRTraits<CDR::UShort> : public CDRIntegralTraits<CDR::UShort, uint16_t> {};
+//! @brief CDR::Integer traits
+template <> struct CDRTraits<CDR::Integer> : public CDRIntegralTraits<CDR::Integer, uint32_t> {};
+//! @brief CDR::UInteger traits
+template <> struct CDRTraits<CDR::UInteger> : public CDRIntegralTraits<CDR::UInteger, uint32_t> {};
+//! @brief CDR::Long traits
+template <> struct CDRTraits<CDR::Long> : public CDRIntegralTraits<CDR::Long, uint64_t> {};
+//! @brief CDR::ULong traits
+template <> struct CDRTraits<CDR::ULong> : public CDRIntegralTraits<CDR::ULong, uint64_t> {};
+
+//! @brief CDR::Boolean traits
+template <>
+struct CDRTraits<CDR::Boolean>
+{
+	enum {
+		FIXED = true,
+		SIZE = 1
+	};
+	template <bool SWAP> static char* encode(char* buf, CDR::Boolean value);
+	template <bool SWAP> static char const* decode(char const* buf, CDR::Boolean& value);
+	static void write(OutputPacket& opack, CDR::Boolean value);
+	static void read(InputPacket& ipack, CDR::Boolean& value);
+	static size_t size(CDR::Boolean) {return SIZE;};
+};
+
+/*! @brief CDR::String traits
+ * @details Strings are variable length fields, they are encoded followed by a null character
+ * in order to be retrieved with InputPacket::operator>>
+ */
+template <>
+struct CDRTraits<CDR::String>
+{
+	enum {
+		FIXED = false,
+		SIZE = 0
+	};
+	template <bool SWAP> static char* encode(char* buf, CDR::String const& value);
+	static void write(OutputPacket& opack, CDR::String const& value);
+	static void read(InputPacket& ipack, CDR::String& value);
+	static size_t size(CDR::String const& value) {return value.size() + 1;};
+};
+
+/*! @struct Field
+ * @brief Describes a member of a structure to marshal
+ * @arg STRUCT : the structure holding the member
+ * @arg TYPE : the CDR type of the member (see NINA::CDR)
+ * @arg MEMBER : pointer on the member
+ */
+template <class STRUCT, typename TYPE, TYPE STRUCT::* MEMBER>
+struct Field
+{
+	enum {
+		FIXED = CDRTraits<TYPE>::FIXED,
+		SIZE = CDRTraits<TYPE>::SIZE
+	};
+	template <bool SWAP> static char* encode(char* buf, STRUCT const& object);
+	template <bool SWAP> static char const* decode(char const* buf, STRUCT& object);
+	static void write(OutputPacket& opack, STRUCT const& object);
+	static void read(InputPacket& ipack, STRUCT& object);
+	static size_t size(STRUCT const& object);
+};
+
+/*! @struct NullField
+ * @brief Terminates a list of fields (see NINA::Layout)
+ */
+struct NullField
+{
+	enum {
+		FIXED = true,
+		SIZE = 0
+	};
+	template <bool SWAP, class STRUCT> static char* encode(char* buf, STRUCT const&) {return buf;}
+	template <bool SWAP, class STRUCT> static char const* decode(char const* buf, STRUCT&) {return buf;}
+	template <class STRUCT> static void write(OutputPacket&, STRUCT const&) {}
+	template <class STRUCT> static void read(InputPacket&, STRUCT&) {}
+	template <class STRUCT> static size_t size(STRUCT const&) {return 0;}
+};
+
+/*! @struct FieldList
+ * @brief Recursive list of fields
+ * @details FIXED and SIZE are computed at compile time over the whole list
+ * @arg HEAD : first field of the list (see NINA::Field)
+ * @arg TAIL : rest of the list (either another FieldList or NINA::NullField)
+ */
+template <class HEAD, class TAIL = NullField>
+struct FieldList
+{
+	enum {
+		FIXED = (HEAD::FIXED && TAIL::FIXED),
+		SIZE = HEAD::SIZE + TAIL::SIZE
+	};
+	template <bool SWAP, class STRUCT> static char* encode(char* buf, STRUCT const& object);
+	template <bool SWAP, class STRUCT> static char const* decode(char const* buf, STRUCT& object);
+	template <class STRUCT> static void write(OutputPacket& opack, STRUCT const& object);
+	template <class STRUCT> static void read(InputPacket& ipack, STRUCT& object);
+	template <class STRUCT> static size_t size(STRUCT const& object);
+};
+
+/*! @struct Layout
+ * @brief Describes the wire layout of a structure as an ordered list of up to eight fields
+ *
+ * @details Example:
+ * @code
+ * struct Move { NINA::CDR::UInteger id; NINA::CDR::Short x; NINA::CDR::Short y; };
+ * typedef NINA::Layout<NINA::Field<Move, NINA::CDR::UInteger, &Move::id>,
+ *                      NINA::Field<Move, NINA::CDR::Short, &Move::x>,
+ *                      NINA::Field<Move, NINA::CDR::Short, &Move::y> > MoveLayout;
+ * NINA::Marshal<Move, MoveLayout>::encode(opacket, move);
+ * @endcode
+ * Longer layouts can be built by chaining NINA::FieldList directly
+ */
+template <class F1, class F2 = NullField, class F3 = NullField, class F4 = NullField,
+		 class F5 = NullField, class F6 = NullField, class F7 = NullField, class F8 = NullField>
+struct Layout : public FieldList<F1, Layout<F2, F3, F4, F5, F6, F7, F8, NullField> > {};
+
+//! @brief Empty layout, terminates the recursion
+template <>
+struct Layout<NullField, NullField, NullField, NullField,
+		NullField, NullField, NullField, NullField> : public NullField {};
+
+/*! @struct MarshalImpl
+ * @brief Implementation of NINA::Marshal, specialized on whether the layout has a fixed size
+ */
+template <class STRUCT, class LAYOUT, bool FIXED>
+struct MarshalImpl;
+
+/*! @class Marshal
+ * @brief Encodes and decodes a whole structure according to its layout
+ *
+ * @details The encoding is generated at compile time and is fully inlined: a structure is
+ * first encoded in a single buffer which is then appended to the packet in one shot.<br/>
+ * When the layout only holds fixed size fields (Marshal::FIXED), this buffer lives on the stack
+ * and decoding consumes the whole structure with a single read.<br/>
+ * The byte order of the packet is checked once per structure: fields are then either copied
+ * straight or byte swapped, without any per field test (see OutputPacket::setByteOrder).<br/>
+ * Packets using the CDR::COMPACT encoding are processed field by field.
+ * @arg STRUCT : the structure to marshal
+ * @arg LAYOUT : the description of its fields (see NINA::Layout)
+ */
+template <class STRUCT, class LAYOUT>
+class Marshal
+{
+	public:
+		enum {
+			FIXED = LAYOUT::FIXED, //!< Whether the encoded size is known at compile time
+			SIZE = LAYOUT::SIZE //!< Encoded size if FIXED, sum of the fixed size fields otherwise
+		};
+
+	public:
+		//! @brief Encode the structure at the end of the packet
+		static void encode(OutputPacket& opack, STRUCT const& object);
+		/*!
+		 * @brief Decode the structure from the packet and consumes it
+		 * @return 0 on success or -1 if the packet was too short
+		 */
+		static int decode(InputPacket& ipack, STRUCT& object);
+		//! @brief Get the encoded size of a given structure (using the CDR::FIXED_WIDTH encoding)
+		static size_t size(STRUCT const& object);
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaMarshal.inl"
+
+#endif /* !__NINA_MARSHAL_HPP__ */
@@ -0,0 +1,250 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaMarshal.inl
+ * @brief Implements the compile-time structure marshalling of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+template <typename TYPE, typename NET_TYPE> template <bool SWAP> NINA_INLINE char*
+CDRIntegralTraits<TYPE, NET_TYPE>::encode(char* buf, TYPE value)
+{
+	NET_TYPE netValue = static_cast<NET_TYPE> (value);
+
+	if (SWAP)
+		netValue = CDR::swap(netValue);
+
+	std::memcpy(buf, &netValue, sizeof(netValue));
+	return buf + sizeof(netValue);
+}
+
+template <typename TYPE, typename NET_TYPE> template <bool SWAP> NINA_INLINE char const*
+CDRIntegralTraits<TYPE, NET_TYPE>::decode(char const* buf, TYPE& value)
+{
+	NET_TYPE netValue;
+
+	std::memcpy(&netValue, buf, sizeof(netValue));
+	if (SWAP)
+		netValue = CDR::swap(netValue);
+	value = static_cast<TYPE> (netValue);
+	return buf + sizeof(netValue);
+}
+
+template <typename TYPE, typename NET_TYPE> NINA_INLINE void
+CDRIntegralTraits<TYPE, NET_TYPE>::write(OutputPacket& opack, TYPE value)
+{
+	opack << value;
+}
+
+template <typename TYPE, typename NET_TYPE> NINA_INLINE void
+CDRIntegralTraits<TYPE, NET_TYPE>::read(InputPacket& ipack, TYPE& value)
+{
+	ipack >> value;
+}
+
+template <bool SWAP> NINA_INLINE char*
+CDRTraits<CDR::Boolean>::encode(char* buf, CDR::Boolean value)
+{
+	*buf = static_cast<char> (value);
+	return buf + 1;
+}
+
+template <bool SWAP> NINA_INLINE char const*
+CDRTraits<CDR::Boolean>::decode(char const* buf, CDR::Boolean& value)
+{
+	value = (*buf != 0);
+	return buf + 1;
+}
+
+NINA_INLINE void
+CDRTraits<CDR::Boolean>::write(OutputPacket& opack, CDR::Boolean value)
+{
+	opack << value;
+}
+
+NINA_INLINE void
+CDRTraits<CDR::Boolean>::read(InputPacket& ipack, CDR::Boolean& value)
+{
+	ipack >> value;
+}
+
+template <bool SWAP> NINA_INLINE char*
+CDRTraits<CDR::String>::encode(char* buf, CDR::String const& value)
+{
+	std::memcpy(buf, value.data(), value.size());
+	buf[value.size()] = '\0';
+	return buf + value.size() + 1;
+}
+
+NINA_INLINE void
+CDRTraits<CDR::String>::write(OutputPacket& opack, CDR::String const& value)
+{
+	opack << value << static_cast<CDR::Char> ('\0');
+}
+
+NINA_INLINE void
+CDRTraits<CDR::String>::read(InputPacket& ipack, CDR::String& value)
+{
+	ipack >> value;
+}
+
+template <class STRUCT, typename TYPE, TYPE STRUCT::* MEMBER> template <bool SWAP> NINA_INLINE char*
+Field<STRUCT, TYPE, MEMBER>::encode(char* buf, STRUCT const& object)
+{
+	return CDRTraits<TYPE>::template encode<SWAP>(buf, object.*MEMBER);
+}
+
+template <class STRUCT, typename TYPE, TYPE STRUCT::* MEMBER> template <bool SWAP> NINA_INLINE char const*
+Field<STRUCT, TYPE, MEMBER>::decode(char const* buf, STRUCT& object)
+{
+	return CDRTraits<TYPE>::template decode<SWAP>(buf, object.*MEMBER);
+}
+
+template <class STRUCT, typename TYPE, TYPE STRUCT::* MEMBER> NINA_INLINE void
+Field<STRUCT, TYPE, MEMBER>::write(OutputPacket& opack, STRUCT const& object)
+{
+	CDRTraits<TYPE>::write(opack, object.*MEMBER);
+}
+
+template <class STRUCT, typename TYPE, TYPE STRUCT::* MEMBER> NINA_INLINE void
+Field<STRUCT, TYPE, MEMBER>::read(InputPacket& ipack, STRUCT& object)
+{
+	CDRTraits<TYPE>::read(ipack, object.*MEMBER);
+}
+
+template <class STRUCT, typename TYPE, TYPE STRUCT::* MEMBER> NINA_INLINE size_t
+Field<STRUCT, TYPE, MEMBER>::size(STRUCT const& object)
+{
+	return CDRTraits<TYPE>::size(object.*MEMBER);
+}
+
+template <class HEAD, class TAIL> template <bool SWAP, class STRUCT> NINA_INLINE char*
+FieldList<HEAD, TAIL>::encode(char* buf, STRUCT const& object)
+{
+	return TAIL::template encode<SWAP>(HEAD::template encode<SWAP>(buf, object), object);
+}
+
+template <class HEAD, class TAIL> template <bool SWAP, class STRUCT> NINA_INLINE char const*
+FieldList<HEAD, TAIL>::decode(char const* buf, STRUCT& object)
+{
+	return TAIL::template decode<SWAP>(HEAD::template decode<SWAP>(buf, object), object);
+}
+
+template <class HEAD, class TAIL> template <class STRUCT> NINA_INLINE void
+FieldList<HEAD, TAIL>::write(OutputPacket& opack, STRUCT const& object)
+{
+	HEAD::write(opack, object);
+	TAIL::write(opack, object);
+}
+
+template <class HEAD, class TAIL> template <class STRUCT> NINA_INLINE void
+FieldList<HEAD, TAIL>::read(InputPacket& ipack, STRUCT& object)
+{
+	HEAD::read(ipack, object);
+	TAIL::read(ipack, object);
+}
+
+template <class HEAD, class TAIL> template <class STRUCT> NINA_INLINE size_t
+FieldList<HEAD, TAIL>::size(STRUCT const& object)
+{
+	return HEAD::size(object) + TAIL::size(object);
+}
+
+//! @brief Fixed size layouts are encoded on the stack and decoded with a single read
+template <class STRUCT, class LAYOUT>
+struct MarshalImpl<STRUCT, LAYOUT, true>
+{
+	static void encode(OutputPacket& opack, STRUCT const& object)
+	{
+		char buf[LAYOUT::SIZE > 0 ? LAYOUT::SIZE : 1];
+
+		if (opack.getEncoding() != CDR::FIXED_WIDTH) {
+			LAYOUT::write(opack, object);
+			return;
+		}
+		if (opack.getByteOrder() == CDR::HOST_ORDER)
+			LAYOUT::template encode<false>(buf, object);
+		else
+			LAYOUT::template encode<true>(buf, object);
+		opack.write(buf, LAYOUT::SIZE);
+	}
+
+	static int decode(InputPacket& ipack, STRUCT& object)
+	{
+		char buf[LAYOUT::SIZE > 0 ? LAYOUT::SIZE : 1];
+
+		if (ipack.getEncoding() != CDR::FIXED_WIDTH) {
+			LAYOUT::read(ipack, object);
+			return (ipack.isTruncated() ? -1 : 0);
+		}
+		if (ipack.read(buf, LAYOUT::SIZE) != static_cast<size_t> (LAYOUT::SIZE))
+			return -1;
+		if (ipack.getByteOrder() == CDR::HOST_ORDER)
+			LAYOUT::template decode<false>(buf, object);
+		else
+			LAYOUT::template decode<true>(buf, object);
+		return 0;
+	}
+};
+
+//! @brief Variable size layouts are encoded in a buffer allocated once and decoded field by field
+template <class STRUCT, class LAYOUT>
+struct MarshalImpl<STRUCT, LAYOUT, false>
+{
+	static void encode(OutputPacket& opack, STRUCT const& object)
+	{
+		if (opack.getEncoding() != CDR::FIXED_WIDTH) {
+			LAYOUT::write(opack, object);
+			return;
+		}
+
+		std::string buf(LAYOUT::size(object), '\0');
+
+		if (opack.getByteOrder() == CDR::HOST_ORDER)
+			LAYOUT::template encode<false>(&buf[0], object);
+		else
+			LAYOUT::template encode<true>(&buf[0], object);
+		opack.write(buf.data(), buf.size());
+	}
+
+	static int decode(InputPacket& ipack, STRUCT& object)
+	{
+		LAYOUT::read(ipack, object);
+		return (ipack.isTruncated() ? -1 : 0);
+	}
+};
+
+template <class STRUCT, class LAYOUT> NINA_INLINE void
+Marshal<STRUCT, LAYOUT>::encode(OutputPacket& opack, STRUCT const& object)
+{
+	MarshalImpl<STRUCT, LAYOUT, FIXED>::encode(opack, object);
+}
+
+template <class STRUCT, class LAYOUT> NINA_INLINE int
+Marshal<STRUCT, LAYOUT>::decode(InputPacket& ipack, STRUCT& object)
+{
+	return MarshalImpl<STRUCT, LAYOUT, FIXED>::decode(ipack, object);
+}
+
+template <class STRUCT, class LAYOUT> NINA_INLINE size_t
+Marshal<STRUCT, LAYOUT>::size(STRUCT const& object)
+{
+	return LAYOUT::size(object);
+}
+
+NINA_END_NAMESPACE_DECL
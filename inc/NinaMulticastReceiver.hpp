@@ -0,0 +1,171 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaMulticastReceiver.hpp
+ * @brief Defines the reception of multicast feeds of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_MULTICASTRECEIVER_HPP__
+# define __NINA_MULTICASTRECEIVER_HPP__
+
+# include "NinaDef.hpp"
+
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251)
+# endif // !NINA_WIN32
+
+# include <vector>
+# include "NinaEventHandler.hpp"
+# include "NinaDatagramBatch.hpp"
+# include "NinaSockDatagram.hpp"
+# include "NinaInetAddr.hpp"
+# include "NinaInetAddrKey.hpp"
+# include "NinaReactor.hpp"
+# include "NinaSAP.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class MulticastReceiver
+ * @brief Receive several multicast feeds through a single EventHandler
+ *
+ * @details The groups sharing a port and a family are joined on a single socket bound on the wildcard address,
+ * one socket is opened per port. Each socket only receives the groups it joined (IP_MULTICAST_ALL is cleared
+ * where available) and reports the destination of its datagrams (see SockDatagram::setPacketInfo) along with their
+ * kernel timestamp, recorded by the reactor before the datagram is handled (see Reactor::recordReceiveLatency).<br/>
+ * All the sockets are registered for the same EventHandler: a reactor wakeup receives a batch from each of the
+ * ready sockets (see SockDatagram::receiveBatch), then every datagram is tagged with its group and handed to
+ * handleDatagram.<br/>
+ * It is necessary to inherit from that class to implement the handling of the datagrams
+ * @arg SYNC_POLICY : policy used by the dispatcher (see NINA::Reactor)
+ */
+template <class SYNC_POLICY = NINADefaultPolicy>
+class MulticastReceiver : public EventHandler
+{
+	public:
+		//! Maximum number of batches received per socket and read event, so that a feed does not starve the others
+		enum { MAX_BATCHES = 8 };
+
+	public:
+		/*! @brief Constructor
+		 * @param[in] reactor : a pointer on the dispatcher used to retrieve socket events
+		 * @param[in] batch : maximum number of datagrams received per system call
+		 * @param[in] datagramSize : maximum size of a datagram, larger ones are truncated
+		 * @throw std::invalid_argument if the reactor is invalid
+		 */
+		MulticastReceiver(Reactor<SYNC_POLICY>* reactor, size_t batch = DatagramBatch::DEFAULT_CAPACITY,
+				size_t datagramSize = DatagramBatch::DEFAULT_DATAGRAM_SIZE);
+		//! @brief Virtual destructor, every group is left
+		virtual ~MulticastReceiver();
+		//! @brief Copy constructor (the groups are not copied)
+		MulticastReceiver(MulticastReceiver const& receiver);
+		//! @brief Assignment operator (the groups are not copied)
+		MulticastReceiver& operator=(MulticastReceiver const& receiver);
+
+	public:
+		//! @brief Receive the pending datagrams of a socket and hand them to handleDatagram
+		virtual int handleRead(NINAHandle handle);
+		virtual int handleWrite(NINAHandle) {return 0;};
+		virtual int handleUrgent(NINAHandle) {return 0;};
+		virtual int handleTimeout(NINAHandle) {return 0;};
+		virtual int handleSignal(NINAHandle) {return 0;};
+		virtual int handleClose(NINAHandle) {return 0;};
+		//! @brief The receiver has a handle per port, thus NINA_INVALID_HANDLE is returned
+		virtual NINAHandle getHandle() const {return NINA_INVALID_HANDLE;};
+		/*!
+		 * @brief Handle a datagram of a group
+		 * @param[in] group : the group the datagram was sent to, as it was joined. If the destination is not reported
+		 * (see DatagramBatch::getDestAddr) while the socket joined several groups, it is the wildcard address of the socket
+		 * @param[in] data : the content of the datagram, only valid during the call
+		 * @param[in] len : the number of bytes of the datagram
+		 * @return 0 on success or -1 to stop receiving the current batch
+		 * @warning Groups must neither be joined nor left from this function
+		 */
+		virtual int handleDatagram(InetAddr const& group, char const* data, size_t len) = 0;
+		/*!
+		 * @brief Join a group, opening the socket of its port if needed
+		 * @param[in] group : the address and port of the group (see InetAddr::isMulticast)
+		 * @param[in] ifIndex : index of the interface receiving the group, 0 to let the system choose it
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int join(InetAddr const& group, unsigned int ifIndex = 0);
+		/*!
+		 * @brief Join a group for the datagrams of a single source only (see SockDatagram::joinSourceGroup)
+		 * @param[in] group : the address and port of the group (see InetAddr::isMulticast)
+		 * @param[in] source : the address of the source
+		 * @param[in] ifIndex : index of the interface receiving the group, 0 to let the system choose it
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int join(InetAddr const& group, InetAddr const& source, unsigned int ifIndex = 0);
+		/*!
+		 * @brief Leave a group for all of its sources, the socket of its port is closed once it has no group left
+		 * @return 0 on success or -1 if the group was not joined
+		 */
+		int leave(InetAddr const& group);
+		//! @brief Leave every group and close the sockets
+		void close();
+		//! @brief Get the number of groups joined (a group joined for several sources counts once per source)
+		size_t getGroupCount() const;
+		//! @brief Get the number of sockets opened
+		size_t getSocketCount() const;
+
+	private:
+		//! Membership of a socket
+		struct Group
+		{
+			InetAddr		addr; //!< Address and port of the group
+			InetAddrKey		key; //!< Key of the group address, without its port
+			InetAddr		source; //!< Source of a source-specific membership
+			bool			hasSource; //!< Whether the membership is source-specific
+			unsigned int	ifIndex; //!< Interface receiving the group
+		};
+
+		//! Socket receiving the groups of a port
+		struct Feed
+		{
+			SockDatagram*		sock; //!< Socket bound on the wildcard address
+			InetAddr			local; //!< Address the socket is bound on
+			std::vector<Group>	groups; //!< Groups joined by the socket
+		};
+
+	private:
+		//! @brief Join a group, for every source or a single one
+		int add(InetAddr const& group, InetAddr const* source, unsigned int ifIndex);
+		//! @brief Get the socket of a family and a port, opening it if needed
+		//! @return the index of the socket or -1 on error
+		int open(int family, uint16_t port);
+		//! @brief Close a socket which has no group left
+		void remove(size_t idx);
+		//! @brief Hand the datagrams of a batch to handleDatagram
+		void dispatch(Feed const& feed);
+
+	private:
+		std::vector<Feed>		mFeeds; //!< Sockets of the receiver, one per port
+		DatagramBatch			mBatch; //!< Datagrams received by the last system call
+		InetAddrKey				mKey; //!< Key of the destination of the datagram being dispatched
+		Reactor<SYNC_POLICY>*	mReactor; //!< Dispatcher used to retrieve events
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaMulticastReceiver.imp"
+# include "NinaMulticastReceiver.inl"
+
+#endif /* !__NINA_MULTICASTRECEIVER_HPP__ */
@@ -0,0 +1,52 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaMulticastReceiver.inl
+ * @brief Implements the reception of multicast feeds of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+template <class SYNC_POLICY> NINA_INLINE int
+MulticastReceiver<SYNC_POLICY>::join(InetAddr const& group, unsigned int ifIndex)
+{
+	return add(group, 0, ifIndex);
+}
+
+template <class SYNC_POLICY> NINA_INLINE int
+MulticastReceiver<SYNC_POLICY>::join(InetAddr const& group, InetAddr const& source, unsigned int ifIndex)
+{
+	return add(group, &source, ifIndex);
+}
+
+template <class SYNC_POLICY> NINA_INLINE size_t
+MulticastReceiver<SYNC_POLICY>::getGroupCount() const
+{
+	size_t	count = 0;
+
+	for (size_t i = 0; i < mFeeds.size(); ++i)
+		count += mFeeds[i].groups.size();
+	return count;
+}
+
+template <class SYNC_POLICY> NINA_INLINE size_t
+MulticastReceiver<SYNC_POLICY>::getSocketCount() const
+{
+	return mFeeds.size();
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,129 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaNetTables.hpp
+ * @brief Defines the cached protocol and service tables of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_NETTABLES_HPP__
+# define __NINA_NETTABLES_HPP__
+
+# include "NinaDef.hpp"
+
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251)
+# endif // !NINA_WIN32
+
+# include <string>
+# include <vector>
+# include "NinaCppUtils.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class NetTables
+ * @brief Protocol and service databases of the operating system, loaded once
+ *
+ * @details The protocols and services files are read the first time the tables are used, then kept
+ * in sorted arrays which are never modified: lookups are binary searches which neither allocate nor lock,
+ * thus the tables are shared by all threads.<br/>
+ * Entries missing from the tables (or every entry when the operating system cannot enumerate its
+ * databases, such as Microsoft Windows) are looked up through the operating system
+ */
+class NINA_DLLREQ NetTables : public NonCopyable
+{
+	public:
+		//! @brief Get the tables, they are loaded on first use
+		static NetTables const& getTables();
+
+	public:
+		/*!
+		 * @brief Get the number of a protocol
+		 * @param[in] name : name or alias of the protocol
+		 * @return the protocol number or -1 if it is unknown
+		 */
+		int getProtocolNumber(char const* name) const;
+		/*!
+		 * @brief Get the official name of a protocol
+		 * @param[in] number : the protocol number
+		 * @param[out] name : the protocol name
+		 * @return 0 on success or -1 if it is unknown
+		 */
+		int getProtocolName(int number, std::string& name) const;
+		/*!
+		 * @brief Get the port of a service
+		 * @param[in] name : name or alias of the service
+		 * @param[in] protocol : protocol used by the service, 0 for any
+		 * @return the port number in host byte order or -1 if it is unknown
+		 */
+		int getServicePort(char const* name, char const* protocol) const;
+		/*!
+		 * @brief Get the official name of the service using a port
+		 * @param[in] port : the port number in host byte order
+		 * @param[in] protocol : protocol used by the service, 0 for any
+		 * @param[out] name : the service name
+		 * @return 0 on success or -1 if it is unknown
+		 */
+		int getServiceName(uint16_t port, char const* protocol, std::string& name) const;
+		//! @brief Get the number of protocol entries loaded (aliases included)
+		size_t getProtocolCount() const;
+		//! @brief Get the number of service entries loaded (aliases included)
+		size_t getServiceCount() const;
+
+	private:
+		//! @brief Constructor, loads the tables
+		NetTables();
+
+	private:
+		//! An entry of the tables
+		struct Entry
+		{
+			std::string	name; //!< Name or alias
+			std::string	officialName; //!< Official name
+			std::string	protocol; //!< Protocol of a service
+			int			number; //!< Protocol number or port in host byte order
+		};
+		//! Ordering of the entries by name
+		struct ByName
+		{
+			bool operator()(Entry const& lhs, Entry const& rhs) const;
+		};
+		//! Ordering of the entries by number
+		struct ByNumber
+		{
+			bool operator()(Entry const& lhs, Entry const& rhs) const;
+		};
+		//! A sorted table
+		typedef std::vector<Entry> Table;
+
+	private:
+		//! @brief Find the first entry matching a name and a protocol (any if 0)
+		static Table::const_iterator findName(Table const& table, char const* name, char const* protocol);
+		//! @brief Find the first entry matching a number and a protocol (any if 0)
+		static Table::const_iterator findNumber(Table const& table, int number, char const* protocol);
+
+	private:
+		Table	mProtocolsByName; //!< Protocols sorted by name
+		Table	mProtocolsByNumber; //!< Protocols sorted by number
+		Table	mServicesByName; //!< Services sorted by name then protocol
+		Table	mServicesByPort; //!< Services sorted by port then protocol
+};
+
+NINA_END_NAMESPACE_DECL
+
+#endif // !__NINA_NETTABLES_HPP__
@@ -44,6 +44,8 @@ NINA_BEGIN_NAMESPACE_DECL
 
 // Forward declaration
 class IOContainer;
+class DatagramBatch;
+struct SendTimestamp;
 
 /*! @class Init
  * @brief Framework initialization class
@@ -104,15 +106,31 @@ int gatherWrite(NINAHandle sock, IOContainer& ioc, unsigned long flags);
 int select(int fdLen, fd_set* readFds, fd_set* writeFds, fd_set* exceptFds, Time const* timeout);
 int poll(NINAPollData* fdSet, unsigned long fdSetLen, Time const* timeout);
 int accept(NINAHandle sock, sockaddr* addr, int* addrLen);
+# if defined (NINA_HAS_ACCEPT4)
+int accept(NINAHandle sock, sockaddr* addr, int* addrLen, int flags);
+# endif // !NINA_HAS_ACCEPT4
 int connect(NINAHandle sock, sockaddr const* addr, int addrLen);
 int recvFrom(NINAHandle sock, void* buf, size_t bufLen, int flags, sockaddr* addr, int* addrLen);
 int sendTo(NINAHandle sock, void const* buf, size_t bufLen, int flags, sockaddr const* addr, int addrLen);
+//! @brief Receive as many datagrams as possible up to the capacity of the batch
+//! @return the number of datagrams received or NINA_ENDPOINT_ERROR
+int recvBatch(NINAHandle sock, DatagramBatch& batch, int flags);
+//! @brief Receive data along with the software receive timestamp of the kernel, Time::timeNull if it was not reported
+int recvTimestamped(NINAHandle sock, void* buf, size_t bufLen, int flags, Time* stamp);
+//! @brief Receive a message from the error queue without blocking, holding a send timestamp or any other error
+//! @return 1 if a send timestamp was received, 0 for another message or NINA_ENDPOINT_ERROR (ENOTSUP if not supported)
+int recvSendTimestamp(NINAHandle sock, SendTimestamp* stamp);
 //! @}
 
 //! @name System informations global functions
 //! @{
 long getOpenMax();
-int	getCurrentTime(NINATimeval* tv);
+//! @brief Get the resident memory of the process in bytes, or -1 on error (ENOTSUP if not supported)
+long getResidentSize();
+//! @brief Get the time elapsed since the UNIX Epoch in nanoseconds
+int	getCurrentTime(int64_t* nSec);
+//! @brief Get the time of a monotonic clock in nanoseconds, coarse is faster but only as precise as the scheduler tick (when supported)
+int	getMonotonicTime(int64_t* nSec, bool coarse = false);
 //! @}
 
  NINA_END_NAMESPACE_OS
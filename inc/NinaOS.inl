@@ -175,6 +175,14 @@ accept(NINAHandle sock, sockaddr* addr, int* addrLen)
 #endif // !NINA_WIN32
 }
 
+#if defined (NINA_HAS_ACCEPT4)
+NINA_INLINE int
+accept(NINAHandle sock, sockaddr* addr, int* addrLen, int flags)
+{
+	return ::accept4(sock, addr, reinterpret_cast<socklen_t*> (addrLen), flags);
+}
+#endif // !NINA_HAS_ACCEPT4
+
 NINA_INLINE int
 connect(NINAHandle sock, sockaddr const* addr, int addrLen)
 {
@@ -32,6 +32,7 @@
 
 # include <sstream>
 # include <cstdio>
+# include <cstring>
 
 # if defined (NINA_POSIX)
 #  include <netinet/in.h>
@@ -69,6 +70,65 @@ struct NINA_DLLREQ CDR
 	typedef uint64_t ULong;
 	//! Type String (equivalent to the STL string)
 	typedef std::string String;
+
+	//! Integer encoding used by a packet
+	enum Encoding {
+		FIXED_WIDTH = 0, //!< Integers are written at full width in the byte order of the packet (see setByteOrder)
+		COMPACT = 1 //!< Integers are written as LEB128 varints, zigzag encoded if signed
+	};
+	//! Maximum size of a LEB128 varint holding 64 bits
+	enum { MAX_VARINT_SIZE = 10 };
+
+	//! Byte order of the fixed width integers of a packet
+	enum ByteOrder {
+		BIG_ENDIAN_ORDER = 0, //!< Most significant byte first
+		LITTLE_ENDIAN_ORDER = 1, //!< Least significant byte first
+		NETWORK_ORDER = BIG_ENDIAN_ORDER, //!< Network byte order (default)
+# if BYTE_ORDER == BIG_ENDIAN
+		HOST_ORDER = BIG_ENDIAN_ORDER //!< Byte order of this host
+# else
+		HOST_ORDER = LITTLE_ENDIAN_ORDER //!< Byte order of this host
+# endif // !BYTE_ORDER == BIG_ENDIAN
+	};
+	//! Flags of the format octet describing a packet (see OutputPacket::writeFormat)
+	enum FormatFlags {
+		FORMAT_LITTLE_ENDIAN = 1, //!< Fixed width integers are little endian
+		FORMAT_COMPACT = 2 //!< Integers use the CDR::COMPACT encoding
+	};
+
+	//! @brief Map a signed integer to an unsigned one so that small magnitudes give small values
+	static uint64_t zigzagEncode(int64_t value);
+	//! @brief Retrieve a signed integer mapped by zigzagEncode
+	static int64_t zigzagDecode(uint64_t value);
+	//! @brief Reverse the byte order of an integer
+	static uint8_t swap(uint8_t value);
+	//! @brief Reverse the byte order of an integer
+	static uint16_t swap(uint16_t value);
+	//! @brief Reverse the byte order of an integer
+	static uint32_t swap(uint32_t value);
+	//! @brief Reverse the byte order of an integer
+	static uint64_t swap(uint64_t value);
+};
+
+/*! @class PacketBuf
+ * @brief String buffer used by the packets
+ *
+ * @details This class exposes the get and put areas of the underlying buffer in order to
+ * decode fields in place and to send a packet content rather than through intermediate copies
+ */
+class NINA_DLLREQ PacketBuf : public std::stringbuf
+{
+	public:
+		//! @brief Get a pointer on the next character to read
+		char const* getReadPtr() const {return gptr();};
+		//! @brief Get the number of contiguous characters readable from getReadPtr
+		size_t getReadAvail() const {return static_cast<size_t> (egptr() - gptr());};
+		//! @brief Consume characters previously read through getReadPtr
+		void consume(size_t len) {gbump(static_cast<int> (len));};
+		//! @brief Get a pointer on the beginning of the buffer
+		char const* getData() const;
+		//! @brief Get the size of the buffer content (same as str().size())
+		size_t getSize() const;
 };
 
 /*! @class OutputPacket
@@ -82,7 +142,8 @@ class NINA_DLLREQ OutputPacket
 	public:
 		//! @brief Constructor
 		//! @param[in] str : an initial string to build the packet
-		OutputPacket(std::string const& str = "");
+		//! @param[in] encoding : integer encoding of the packet (see NINA::CDR::Encoding)
+		OutputPacket(std::string const& str = "", CDR::Encoding encoding = CDR::FIXED_WIDTH);
 		//! @brief Virtual destructor
 		virtual ~OutputPacket() {};
 		//! @brief Copy constructor
@@ -125,17 +186,75 @@ class NINA_DLLREQ OutputPacket
 		//! @brief Adds a string field to the packet
 		//! @param[in] value : value to add (see NINA::CDR)
 		OutputPacket& operator<<(CDR::String const& str);
+		/*!
+		 * @brief Adds raw bytes to the packet
+		 * @details The bytes are copied as is without any byte ordering conversion
+		 * @param[in] data : bytes to add
+		 * @param[in] len : number of bytes to add
+		 */
+		void write(char const* data, size_t len);
 		//! @brief Dump the packet in an unformatted string
 		//! @return a copy of the packet in a string format
 		std::string dump() const;
+		/*!
+		 * @brief Get a pointer on the packet content without copying it
+		 * @details The pointer is invalidated by any further modification of the packet
+		 * @return a pointer on getSize() bytes
+		 */
+		char const* getData() const;
+		//! @brief Get the size of the packet content
+		size_t getSize() const;
 		//! @brief Assign a string to the packet, thus replacing its whole content
 		//! @param[in] str : the input string to replace packet informations
 		void assign(std::string const& str);
 		//! @brief Clear the packet, destroying all of its content
 		void clear();
+		//! @brief Set the integer encoding of the fields added afterwards
+		//! @details Both peers have to agree on it, the default one is CDR::FIXED_WIDTH
+		void setEncoding(CDR::Encoding encoding);
+		//! @brief Get the integer encoding of the packet
+		CDR::Encoding getEncoding() const;
+		/*!
+		 * @brief Set the byte order of the fixed width integers added afterwards
+		 * @details The default one is CDR::NETWORK_ORDER, using CDR::HOST_ORDER avoids any byte swapping
+		 * when the peers share the same architecture (see OutputPacket::writeFormat)
+		 */
+		void setByteOrder(CDR::ByteOrder byteOrder);
+		//! @brief Get the byte order of the packet
+		CDR::ByteOrder getByteOrder() const;
+		/*!
+		 * @brief Adds the format octet of the packet (byte order and encoding, see CDR::FormatFlags)
+		 * @details Used at the beginning of a packet, it lets the receiver adapt itself through
+		 * InputPacket::readFormat, swapping bytes only if the byte orders differ
+		 */
+		OutputPacket& writeFormat();
+		/*!
+		 * @brief Adds the CRC32C of the whole packet content as a trailer (see NINA::CRC32C)
+		 * @details The checksum is computed in a single pass right after the serialization, then written
+		 * as hexadecimal digits. It is checked by a PacketFactory built with checksums enabled
+		 */
+		OutputPacket& writeChecksum();
+		/*!
+		 * @brief Adds an array of CDR integers to the packet
+		 * @details The whole array is copied at once if no byte swapping is required
+		 * @param[in] values : array to add (see NINA::CDR)
+		 * @param[in] count : number of elements
+		 */
+		template <typename TYPE>
+		OutputPacket& writeArray(TYPE const* values, size_t count);
 
 	private:
-		std::stringbuf	mStream; //!< Underlying stream
+		//! @brief Adds a LEB128 varint to the packet
+		OutputPacket& putVarint(uint64_t value);
+		//! @brief Adds a fixed width integer to the packet according to its byte order
+		template <typename NET_TYPE>
+		OutputPacket& putFixed(NET_TYPE value);
+
+	private:
+		PacketBuf		mStream; //!< Underlying stream
+		CDR::Encoding	mEncoding; //!< Integer encoding
+		CDR::ByteOrder	mByteOrder; //!< Byte order of the fixed width integers
+		bool			mSwap; //!< Whether the byte order differs from the host one
 };
 
 /*! @class InputPacket
@@ -149,7 +268,8 @@ class NINA_DLLREQ InputPacket
 	public:
 		//! @brief Constructor
 		//! @param[in] str : an initial string to build the packet
-		InputPacket(std::string const& str = "");
+		//! @param[in] encoding : integer encoding of the packet (see NINA::CDR::Encoding)
+		InputPacket(std::string const& str = "", CDR::Encoding encoding = CDR::FIXED_WIDTH);
 		//! @brief Virtual destructor
 		virtual ~InputPacket() {};
 		//! @brief Copy constructor
@@ -237,11 +357,72 @@ class NINA_DLLREQ InputPacket
 		 * @param[in] len : length of the string
 		 */
 		void get(CDR::String& str, size_t len);
+		/*!
+		 * @brief Retrieves raw bytes from the packet and consumes them
+		 * @details The bytes are copied as is without any byte ordering conversion
+		 * @param[out] data : a buffer to store the bytes
+		 * @param[in] len : number of bytes to retrieve
+		 * @return the number of bytes actually retrieved
+		 */
+		size_t read(char* data, size_t len);
 		//! @brief Clear the packet, destroying all of its content
 		void clear();
+		/*!
+		 * @brief Check whether a field was retrieved past the end of the packet
+		 * @details This happens on a truncated packet, or on a malformed varint with the CDR::COMPACT encoding.
+		 * The state is kept until the content of the packet is replaced (see assign and clear)
+		 */
+		bool isTruncated() const;
+		//! @brief Set the integer encoding of the fields retrieved afterwards
+		//! @details Both peers have to agree on it, the default one is CDR::FIXED_WIDTH
+		void setEncoding(CDR::Encoding encoding);
+		//! @brief Get the integer encoding of the packet
+		CDR::Encoding getEncoding() const;
+		/*!
+		 * @brief Set the byte order of the fixed width integers retrieved afterwards
+		 * @details This is the byte order of the sender, bytes are swapped only if it differs from the host one
+		 */
+		void setByteOrder(CDR::ByteOrder byteOrder);
+		//! @brief Get the byte order of the packet
+		CDR::ByteOrder getByteOrder() const;
+		/*!
+		 * @brief Retrieves the format octet written by OutputPacket::writeFormat and consumes it
+		 * @details The byte order and the encoding of the packet are set accordingly
+		 * @return 0 on success or -1 if the packet is empty
+		 */
+		int readFormat();
+		/*!
+		 * @brief Retrieves an array of CDR integers from the packet and consumes it
+		 * @details The whole array is copied at once if no byte swapping is required
+		 * @param[out] values : array to fill in (see NINA::CDR)
+		 * @param[in] count : number of elements
+		 * @return the number of elements retrieved
+		 */
+		template <typename TYPE>
+		size_t readArray(TYPE* values, size_t count);
+
+	private:
+		//! @brief Retrieves a fixed width integer from the packet according to its byte order
+		template <typename NET_TYPE>
+		NET_TYPE getFixed() const;
+		//! @brief Retrieves a fixed width integer from the packet without consuming it
+		template <typename NET_TYPE>
+		NET_TYPE peekFixed() const;
+		/*!
+		 * @brief Retrieves a LEB128 varint from the packet and consumes it
+		 * @details When enough bytes are buffered, varints up to 8 bytes are decoded
+		 * without branching on each byte
+		 */
+		uint64_t getVarint() const;
+		//! @brief Retrieves a LEB128 varint from the packet without consuming it
+		uint64_t peekVarint() const;
 
 	private:
-		mutable std::stringbuf	mStream; //!< Underlying stream
+		mutable PacketBuf	mStream; //!< Underlying stream
+		CDR::Encoding		mEncoding; //!< Integer encoding
+		CDR::ByteOrder		mByteOrder; //!< Byte order of the fixed width integers
+		bool				mSwap; //!< Whether the byte order differs from the host one
+		mutable bool		mIsTruncated; //!< Whether a field was retrieved past the end of the packet
 };
 
 NINA_END_NAMESPACE_DECL
@@ -21,6 +21,92 @@
 
 NINA_BEGIN_NAMESPACE_DECL
 
+NINA_INLINE uint64_t
+CDR::zigzagEncode(int64_t value)
+{
+	return (static_cast<uint64_t> (value) << 1) ^ static_cast<uint64_t> (value >> 63);
+}
+
+NINA_INLINE int64_t
+CDR::zigzagDecode(uint64_t value)
+{
+	return static_cast<int64_t> ((value >> 1) ^ (~(value & 1) + 1));
+}
+
+NINA_INLINE char const*
+PacketBuf::getData() const
+{
+	return (pptr() == 0) ? eback() : pbase();
+}
+
+NINA_INLINE size_t
+PacketBuf::getSize() const
+{
+	char* end = pptr();
+
+	// Mirrors the high water mark used by std::stringbuf::str
+	if (end == 0)
+		return static_cast<size_t> (egptr() - eback());
+	if (egptr() > end)
+		end = egptr();
+	return static_cast<size_t> (end - pbase());
+}
+
+NINA_INLINE uint8_t
+CDR::swap(uint8_t value)
+{
+	return value;
+}
+
+NINA_INLINE uint16_t
+CDR::swap(uint16_t value)
+{
+	return static_cast<uint16_t> ((value << 8) | (value >> 8));
+}
+
+NINA_INLINE uint32_t
+CDR::swap(uint32_t value)
+{
+#if defined (__GNUC__)
+	return __builtin_bswap32(value);
+#else
+	return ((value & 0xFF) << 24) | ((value & 0xFF00) << 8) |
+		((value >> 8) & 0xFF00) | (value >> 24);
+#endif // !__GNUC__
+}
+
+NINA_INLINE uint64_t
+CDR::swap(uint64_t value)
+{
+#if defined (__GNUC__)
+	return __builtin_bswap64(value);
+#else
+	return (static_cast<uint64_t> (swap(static_cast<uint32_t> (value))) << 32) |
+		swap(static_cast<uint32_t> (value >> 32));
+#endif // !__GNUC__
+}
+
+template <typename NET_TYPE> NINA_INLINE OutputPacket&
+OutputPacket::putFixed(NET_TYPE value)
+{
+	if (mSwap == true)
+		value = CDR::swap(value);
+	mStream.sputn(reinterpret_cast<char const*> (&value), sizeof(value));
+	return *this;
+}
+
+template <typename TYPE> NINA_INLINE OutputPacket&
+OutputPacket::writeArray(TYPE const* values, size_t count)
+{
+	if (mSwap == false && mEncoding == CDR::FIXED_WIDTH) {
+		mStream.sputn(reinterpret_cast<char const*> (values), count * sizeof(TYPE));
+		return *this;
+	}
+	for (size_t i = 0; i < count; ++i)
+		*this << values[i];
+	return *this;
+}
+
 NINA_INLINE bool
 OutputPacket::operator==(OutputPacket const& opack) const
 {
@@ -57,55 +143,49 @@ OutputPacket::operator<<(CDR::UChar value)
 NINA_INLINE OutputPacket&
 OutputPacket::operator<<(CDR::Short value)
 {
-	CDR::Short netValue = htons(value);
-
-	mStream.sputn(reinterpret_cast<char const*> (&netValue), sizeof(netValue));
-	return *this;
+	if (mEncoding == CDR::COMPACT)
+		return putVarint(CDR::zigzagEncode(value));
+	return putFixed(static_cast<uint16_t> (value));
 }
 
 NINA_INLINE OutputPacket&
 OutputPacket::operator<<(CDR::UShort value)
 {
-	CDR::UShort netValue = htons(value);
-
-	mStream.sputn(reinterpret_cast<char const*> (&netValue), sizeof(netValue));
-	return *this;
+	if (mEncoding == CDR::COMPACT)
+		return putVarint(value);
+	return putFixed(static_cast<uint16_t> (value));
 }
 
 NINA_INLINE OutputPacket&
 OutputPacket::operator<<(CDR::Integer value)
 {
-	CDR::Integer netValue = htonl(value);
-
-	mStream.sputn(reinterpret_cast<char const*> (&netValue), sizeof(netValue));
-	return *this;
+	if (mEncoding == CDR::COMPACT)
+		return putVarint(CDR::zigzagEncode(value));
+	return putFixed(static_cast<uint32_t> (value));
 }
 
 NINA_INLINE OutputPacket&
 OutputPacket::operator<<(CDR::UInteger value)
 {
-	CDR::UInteger netValue = htonl(value);
-
-	mStream.sputn(reinterpret_cast<char const*> (&netValue), sizeof(netValue));
-	return *this;
+	if (mEncoding == CDR::COMPACT)
+		return putVarint(value);
+	return putFixed(static_cast<uint32_t> (value));
 }
 
 NINA_INLINE OutputPacket&
 OutputPacket::operator<<(CDR::Long value)
 {
-	CDR::Long netValue = static_cast<CDR::Long> (htonll(value));
-
-	mStream.sputn(reinterpret_cast<char const*> (&netValue), sizeof(netValue));
-	return *this;
+	if (mEncoding == CDR::COMPACT)
+		return putVarint(CDR::zigzagEncode(value));
+	return putFixed(static_cast<uint64_t> (value));
 }
 
 NINA_INLINE OutputPacket&
 OutputPacket::operator<<(CDR::ULong value)
 {
-	CDR::ULong netValue = htonll(value);
-
-	mStream.sputn(reinterpret_cast<char const*> (&netValue), sizeof(netValue));
-	return *this;
+	if (mEncoding == CDR::COMPACT)
+		return putVarint(value);
+	return putFixed(static_cast<uint64_t> (value));
 }
 
 NINA_INLINE OutputPacket&
@@ -115,12 +195,30 @@ OutputPacket::operator<<(CDR::String const& str)
 	return *this;
 }
 
+NINA_INLINE void
+OutputPacket::write(char const* data, size_t len)
+{
+	mStream.sputn(data, len);
+}
+
 NINA_INLINE std::string
 OutputPacket::dump() const
 {
 	return mStream.str();
 }
 
+NINA_INLINE char const*
+OutputPacket::getData() const
+{
+	return mStream.getData();
+}
+
+NINA_INLINE size_t
+OutputPacket::getSize() const
+{
+	return mStream.getSize();
+}
+
 NINA_INLINE void
 OutputPacket::assign(std::string const& str)
 {
@@ -135,6 +233,66 @@ OutputPacket::clear()
 	mStream.pubseekpos(0);
 }
 
+NINA_INLINE void
+OutputPacket::setEncoding(CDR::Encoding encoding)
+{
+	mEncoding = encoding;
+}
+
+NINA_INLINE CDR::Encoding
+OutputPacket::getEncoding() const
+{
+	return mEncoding;
+}
+
+NINA_INLINE void
+OutputPacket::setByteOrder(CDR::ByteOrder byteOrder)
+{
+	mByteOrder = byteOrder;
+	mSwap = (byteOrder != CDR::HOST_ORDER);
+}
+
+NINA_INLINE CDR::ByteOrder
+OutputPacket::getByteOrder() const
+{
+	return mByteOrder;
+}
+
+template <typename NET_TYPE> NINA_INLINE NET_TYPE
+InputPacket::getFixed() const
+{
+	NET_TYPE value = 0;
+
+	if (mStream.getReadAvail() >= sizeof(value)) {
+		std::memcpy(&value, mStream.getReadPtr(), sizeof(value));
+		mStream.consume(sizeof(value));
+	}
+	else if (mStream.sgetn(reinterpret_cast<char*> (&value), sizeof(value)) != sizeof(value))
+		mIsTruncated = true;
+	return (mSwap == true) ? CDR::swap(value) : value;
+}
+
+template <typename NET_TYPE> NINA_INLINE NET_TYPE
+InputPacket::peekFixed() const
+{
+	NET_TYPE		value = 0;
+	std::streamsize	sz;
+
+	sz = mStream.sgetn(reinterpret_cast<char*> (&value), sizeof(value));
+	mStream.pubseekoff(-sz, std::ios_base::cur, std::ios_base::in);
+	return (mSwap == true) ? CDR::swap(value) : value;
+}
+
+template <typename TYPE> NINA_INLINE size_t
+InputPacket::readArray(TYPE* values, size_t count)
+{
+	if (mSwap == false && mEncoding == CDR::FIXED_WIDTH)
+		return read(reinterpret_cast<char*> (values), count * sizeof(TYPE)) / sizeof(TYPE);
+	for (size_t i = 0; i < count; ++i)
+		*this >> values[i];
+	return count;
+}
+
 NINA_INLINE bool
 InputPacket::operator==(InputPacket const& ipack) const
 {
@@ -156,81 +314,93 @@ InputPacket::operator<(InputPacket const&) const
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::Boolean& value)
 {
-	value = (mStream.sbumpc() != 0);
+	int	c = mStream.sbumpc();
+
+	if (c == EOF)
+		mIsTruncated = true;
+	value = (c != 0);
 	return *this;
 }
 
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::Char& value)
 {
-	value = mStream.sbumpc();
+	int	c = mStream.sbumpc();
+
+	if (c == EOF)
+		mIsTruncated = true;
+	value = static_cast<CDR::Char> (c);
 	return *this;
 }
 
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::UChar& value)
 {
-	value = mStream.sbumpc();
+	int	c = mStream.sbumpc();
+
+	if (c == EOF)
+		mIsTruncated = true;
+	value = static_cast<CDR::UChar> (c);
 	return *this;
 }
 
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::Short& value)
 {
-	CDR::Short	hostValue;
-
-	mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	value = ntohs(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::Short> (CDR::zigzagDecode(getVarint()));
+	else
+		value = static_cast<CDR::Short> (getFixed<uint16_t>());
 	return *this;
 }
 
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::UShort& value)
 {
-	CDR::UShort	hostValue;
-
-	mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	value = ntohs(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::UShort> (getVarint());
+	else
+		value = static_cast<CDR::UShort> (getFixed<uint16_t>());
 	return *this;
 }
 
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::Integer& value)
 {
-	CDR::Integer hostValue;
-
-	mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	value = ntohl(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::Integer> (CDR::zigzagDecode(getVarint()));
+	else
+		value = static_cast<CDR::Integer> (getFixed<uint32_t>());
 	return *this;
 }
 
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::UInteger& value)
 {
-	CDR::UInteger hostValue;
-
-	mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	value = ntohl(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::UInteger> (getVarint());
+	else
+		value = static_cast<CDR::UInteger> (getFixed<uint32_t>());
 	return *this;
 }
 
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::Long& value)
 {
-	CDR::Long hostValue;
-
-	mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	value = ntohll(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::Long> (CDR::zigzagDecode(getVarint()));
+	else
+		value = static_cast<CDR::Long> (getFixed<uint64_t>());
 	return *this;
 }
 
 NINA_INLINE InputPacket&
 InputPacket::operator>>(CDR::ULong& value)
 {
-	CDR::ULong hostValue;
-
-	mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	value = ntohll(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::ULong> (getVarint());
+	else
+		value = static_cast<CDR::ULong> (getFixed<uint64_t>());
 	return *this;
 }
 
@@ -266,11 +436,53 @@ InputPacket::assign(std::string const& str)
 	mStream.str(str);
 }
 
+NINA_INLINE size_t
+InputPacket::read(char* data, size_t len)
+{
+	size_t	readLen = static_cast<size_t> (mStream.sgetn(data, len));
+
+	if (readLen != len)
+		mIsTruncated = true;
+	return readLen;
+}
+
 NINA_INLINE void
 InputPacket::clear()
 {
 	mStream.str("");
 	mStream.pubseekpos(0);
+	mIsTruncated = false;
+}
+
+NINA_INLINE bool
+InputPacket::isTruncated() const
+{
+	return mIsTruncated;
+}
+
+NINA_INLINE void
+InputPacket::setEncoding(CDR::Encoding encoding)
+{
+	mEncoding = encoding;
+}
+
+NINA_INLINE CDR::Encoding
+InputPacket::getEncoding() const
+{
+	return mEncoding;
+}
+
+NINA_INLINE void
+InputPacket::setByteOrder(CDR::ByteOrder byteOrder)
+{
+	mByteOrder = byteOrder;
+	mSwap = (byteOrder != CDR::HOST_ORDER);
+}
+
+NINA_INLINE CDR::ByteOrder
+InputPacket::getByteOrder() const
+{
+	return mByteOrder;
 }
 
 NINA_END_NAMESPACE_DECL
@@ -24,9 +24,11 @@
 
 # include <cstring>
 # include <list>
+# include <stdexcept>
 # include "NinaDef.hpp"
 # include "NinaCppUtils.hpp"
 # include "NinaPacket.hpp"
+# include "NinaCRC32C.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
 
@@ -34,7 +36,10 @@ NINA_BEGIN_NAMESPACE_DECL
  * @brief Creates packets upon bytes stream protocols
  *
  * @details This class acts as a factory, it analyses an incoming stream and tries to build
- * packets according to the delimiter sequence which is set
+ * packets according to the delimiter sequence which is set.<br/>
+ * Frames can optionally end with a CRC32C trailer (see OutputPacket::writeChecksum) computed while the
+ * bytes are buffered, corrupt frames are then counted and dropped before being turned into packets.<br/>
+ * The trailer is made of hexadecimal digits, thus it never holds a delimiter sequence free of them
  * @arg IN_PACKET : type of the packet to build. Note that this class should inherit from NINA::InputPacket
  */ 
 template <class IN_PACKET = InputPacket>
@@ -67,7 +72,9 @@ class PacketFactory : public NonCopyable
 		PacketFactory();
 		//! @brief Constructor
 		//! @param[in] sequence : sequence of characters delimiting an incoming packet
-		PacketFactory(std::string const& sequence);
+		//! @param[in] checksum : whether frames end with a CRC32C trailer which has to be checked
+		//! @throw std::invalid_argument if checksums are enabled while the sequence holds hexadecimal digits
+		PacketFactory(std::string const& sequence, bool checksum = false);
 		//! @brief Destructor
 		~PacketFactory();
 
@@ -104,6 +111,8 @@ class PacketFactory : public NonCopyable
 		//! @brief Removes packets from the iterator first to the iterator last (first included)
 		//! @return an iterator on the following packet, namely last
 		iterator remove(iterator first, iterator last);
+		//! @brief Get the number of frames dropped because of a checksum mismatch
+		size_t getCorruptFrames() const;
 	private:
 		//! @brief Update the payload with the circular buffer data
 		void updatePayload();
@@ -115,6 +124,10 @@ class PacketFactory : public NonCopyable
 		std::string	mPayload; //!< Holds incomplete packet informations
 		std::string mSequence; //!< End of packet delimiter
 		PacketList	mList; //!< Pending packet list
+		bool		mChecksum; //!< Whether frames end with a CRC32C trailer
+		CRC32C		mCRC; //!< Checksum of the current payload, without the bytes which may be its trailer
+		size_t		mChecked; //!< Number of bytes of the current payload processed by the checksum
+		size_t		mCorruptFrames; //!< Number of frames dropped
 };
 
 NINA_END_NAMESPACE_DECL
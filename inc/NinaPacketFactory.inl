@@ -50,11 +50,30 @@ PacketFactory<IN_PACKET>::updatePayload()
 {
 	for (size_t i = mWheel.rPtr; i != mWheel.wPtr; i = (i + 1) % BUF_SIZE)
 		mPayload.push_back(mWheel.data[i]);
+	// The last bytes may be the trailer, they are only processed once followed by others
+	if (mChecksum == true && mPayload.size() > mChecked + CRC32C::SIZE) {
+		mCRC.update(mPayload.data() + mChecked, mPayload.size() - CRC32C::SIZE - mChecked);
+		mChecked = mPayload.size() - CRC32C::SIZE;
+	}
 }
 
 template <class IN_PACKET> NINA_INLINE void
 PacketFactory<IN_PACKET>::forgePacket()
 {
+	uint32_t	trailer;
+
+	if (mChecksum == true && mPayload.size() > 0) {
+		if (mPayload.size() <= CRC32C::SIZE
+				|| CRC32C::load(mPayload.data() + mPayload.size() - CRC32C::SIZE, &trailer) < 0
+				|| mCRC.getValue() != trailer) {
+			++mCorruptFrames;
+			mPayload.clear();
+		}
+		else
+			mPayload.resize(mPayload.size() - CRC32C::SIZE);
+		mCRC.reset();
+		mChecked = 0;
+	}
 	if (mPayload.size() > 0) {
 		IN_PACKET ipacket;
 		ipacket.assign(mPayload);
@@ -99,4 +118,10 @@ PacketFactory<IN_PACKET>::remove(iterator first, iterator last)
 	return mList.erase(first, last);
 }
 
+template <class IN_PACKET> NINA_INLINE size_t
+PacketFactory<IN_PACKET>::getCorruptFrames() const
+{
+	return mCorruptFrames;
+}
+
 NINA_END_NAMESPACE_DECL
@@ -28,6 +28,9 @@
 # include "NinaTime.hpp"
 # include "NinaSystemError.hpp"
 # include "NinaEventHandler.hpp"
+# include "NinaTimerQueue.hpp"
+# include "NinaIdleWheel.hpp"
+# include "NinaLatencyHistogram.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
 
@@ -52,6 +55,20 @@ struct NINA_DLLREQ Events
 	};
 };
 
+/*! @struct DrainReport
+ * @brief Outcome of a drain (see NINA::Reactor::drain)
+ */
+struct NINA_DLLREQ DrainReport
+{
+	//! @brief Constructor
+	DrainReport() : notified(0), closed(0), forced(0), elapsed(0, 0) {};
+
+	size_t	notified; //!< Number of handles notified through EventHandler::handleDrain
+	size_t	closed; //!< Number of handles closed at once (see EventHandler::handleDrain)
+	size_t	forced; //!< Number of handles closed at the deadline
+	Time	elapsed; //!< Duration of the drain
+};
+
 NINA_END_NAMESPACE_DECL
 
 # include "NinaSelectPolicy.hpp"
@@ -71,11 +88,13 @@ NINA_BEGIN_NAMESPACE_DECL
  *
  * @details This class is one of the main classes used in event driven environements<br/>
  * It provides a dispatcher allowing users to register their handles and wait for their triggering<br/>
- * When an handle is triggered, its associated EventHandler calls the appropriate method to manage the evenement occurred
+ * When an handle is triggered, its associated EventHandler calls the appropriate method to manage the evenement occurred<br/>
+ * Several reactors may coexist, typically one per thread, each of them dispatching its own handles without any lock
+ * (see Acceptor::open to shard a listening address between them)
  * @arg SYNC_POLICY : represents the backend used by the Reactor (see NINA::PollPolicy, NINA::EpollPolicy, NINA::KqueuePolicy, NINA::SelectPolicy)
  */ 
 template <class SYNC_POLICY = NINADefaultPolicy>
-class Reactor : public Singleton<Reactor<SYNC_POLICY> >
+class Reactor : public NonCopyable
 {
 	public:
 		//! Constructor
@@ -129,7 +148,9 @@ class Reactor : public Singleton<Reactor<SYNC_POLICY> >
 		 * @brief Monitor registered handles and dispatch an event
 		 * @details Wait that an event occurs, then call the appropriate method on the EventHandler concerned<br/>
 		 * If no event occurred until the timeout is reached, EventHandler::handleTimeout is dispatched to all EventHandlers registered<br/>
-		 * If a signal is caught during the processing, EventHandler::handleSignal is dispatched to all EventHandlers registered
+		 * If a signal is caught during the processing, EventHandler::handleSignal is dispatched to all EventHandlers registered<br/>
+		 * The wait is shortened to the nearest timer deadline, then the expired timers are dispatched (see scheduleTimer below)<br/>
+		 * Likewise, the wait is shortened to the next tick of the idle timeouts (see trackIdle below)
 		 * @param[in] timeout : time before giving up the monitoring
 		 * @arg 0 = wait forever
 		 * @arg Time::timeNull = effect a polling and return immediately
@@ -137,14 +158,147 @@ class Reactor : public Singleton<Reactor<SYNC_POLICY> >
 		 * If an error occurred errno will be set accordingly
 		 */
 		int handleEvents(Time const* timeout);
-		//! @brief Monitor registered handles and dispatch events until an error occurred on the Reactor (see handleEvents above)
-		//! @details Also print the errors NINA::Error::SystemError on the error output which occurred while handling events, useful for the Acceptor pattern with THROW_ON_ERR enabled
+		/*!
+		 * @brief Monitor registered handles and dispatch events until an error occurred on the Reactor or until
+		 * a drain completed (see handleEvents above and drain below)
+		 * @details Also print the errors NINA::Error::SystemError on the error output which occurred while handling events, useful for the Acceptor pattern with THROW_ON_ERR enabled
+		 */
 		void handleEventsLoop();
+		/*!
+		 * @brief Drain the reactor before a shutdown
+		 * @details EventHandler::handleDrain is dispatched to every registered handle: Acceptors stop accepting,
+		 * idle handlers are closed at once and busy ones finish their work then remove their events.<br/>
+		 * The drain completes during handleEvents once no handle is registered anymore, or once the timeout elapsed
+		 * in which case the remaining handles are removed then closed (see EventHandler::handleClose)
+		 * @param[in] timeout : time granted to the handlers
+		 * @return 0 on success or -1 if a drain is already in progress
+		 */
+		int drain(Time const& timeout);
+		//! @brief Check whether a drain is in progress
+		bool isDraining() const;
+		//! @brief Get the report of the last drain
+		DrainReport const& getDrainReport() const;
+		/*!
+		 * @brief Schedule a one-shot timer
+		 * @details Once the delay elapsed, EventHandler::handleTimer is dispatched with the identifier of the timer
+		 * during a call to handleEvents
+		 * @param[in] eHandler : EventHandler notified of the expiration
+		 * @param[in] delay : time before the expiration
+		 * @return the identifier of the timer or -1 on error
+		 */
+		long scheduleTimer(EventHandler* eHandler, Time const& delay);
+		/*!
+		 * @brief Cancel a pending timer
+		 * @param[in] timerId : identifier returned by scheduleTimer
+		 * @return 0 on success or -1 if the timer does not exist (already expired or cancelled)
+		 */
+		int cancelTimer(long timerId);
+		/*!
+		 * @brief Track the inactivity of an EventHandler
+		 * @details Once no read, write or urgent event has been dispatched to the EventHandler for the given timeout,
+		 * EventHandler::handleIdle is dispatched during a call to handleEvents<br/>
+		 * Timeouts are coarse: they may expire up to one granularity late (see setIdleGranularity below).
+		 * Events only stamp the EventHandler (see EventHandler::getLastActivity), thus tracking many active
+		 * EventHandlers costs nearly nothing
+		 * @warning The EventHandler must be untracked before its destruction
+		 * @param[in] eHandler : EventHandler to track, its timeout is updated if it is already tracked
+		 * @param[in] timeout : time of inactivity after which the EventHandler is notified
+		 * @return 0 on success or -1 on error
+		 */
+		int trackIdle(EventHandler* eHandler, Time const& timeout);
+		//! @brief Stop tracking the inactivity of an EventHandler
+		//! @return 0 on success or -1 if the EventHandler is not tracked
+		int untrackIdle(EventHandler* eHandler);
+		/*!
+		 * @brief Set the precision of the idle timeouts (one second by default)
+		 * @return 0 on success or -1 if EventHandlers are tracked
+		 */
+		int setIdleGranularity(Time const& granularity);
+		/*!
+		 * @brief Get the time of the current loop iteration
+		 * @details The time is read from a monotonic clock (see Time::monotonic) once per call to handleEvents,
+		 * on its first request, rather than once per event. Timers, idle timeouts and the loop lag use it as well,
+		 * thus they are immune to the adjustments of the system clock.<br/>
+		 * Outside of handleEvents the clock is read on each call
+		 */
+		Time const& now() const;
+		/*!
+		 * @brief Set whether the coarse monotonic clock is used
+		 * @details The coarse clock is cheaper to read but only as precise as the scheduler tick (a few milliseconds),
+		 * which is enough for most timeouts
+		 */
+		void setCoarseClock(bool isCoarse);
+		/*!
+		 * @brief Set whether the lag of the loop is measured (see getLoopLag)
+		 * @details Measuring it reads the clock once more on each iteration dispatching events
+		 */
+		void setLoopLagTracking(bool isTracked);
+		/*!
+		 * @brief Get the lag of the loop
+		 * @details It is the time spent dispatching the events of the last call to handleEvents, namely the delay
+		 * endured by its last events. It stays null unless it is measured (see setLoopLagTracking)
+		 */
+		Time const& getLoopLag() const;
+		//! @brief Get the number of handles registered
+		size_t getHandleCount() const;
+		/*!
+		 * @brief Record the receive latency of data about to be handled
+		 * @details It is the time elapsed from the reception of the data by the kernel to the start of its handling,
+		 * namely the time spent in the socket queue then waiting for the loop. Kernel timestamps are real times, thus
+		 * it is measured against the real time clock rather than now().<br/>
+		 * DatagramAcceptor and MulticastReceiver record it for each datagram once timestamps are enabled on their
+		 * socket (see SockIO::setTimestamping), other handlers may call it with the timestamps of SockIO::receive
+		 * @param[in] stamp : receive timestamp of the kernel, ignored if null
+		 */
+		void recordReceiveLatency(Time const& stamp);
+		//! @brief Get the histogram of the receive latencies (see recordReceiveLatency above)
+		LatencyHistogram const& getReceiveLatency() const;
+		//! @brief Forget the receive latencies recorded, such as after a report
+		void resetReceiveLatency();
+		/*!
+		 * @brief Get the reactor of the calling thread
+		 * @details It is the last reactor which dispatched events on the calling thread, or failing that,
+		 * the first one constructed on it<br/>
+		 * An assertion is done checking that such a reactor exists, if not an abort is raised @see NINA_ASSERT_SINGLETON
+		 * @return A reference on the reactor
+		 */
+		static Reactor& getSingleton();
+		//! @brief Get a pointer on the reactor of the calling thread (see getSingleton above)
+		static Reactor* getSingletonPtr();
+
+	private:
+		//! Marks a loop iteration for its whole scope, even if an exception escapes from a handler
+		struct LoopScope
+		{
+			LoopScope(ReactorImplement* reactImplement) : impl(reactImplement) {impl->setLooping(true);};
+			~LoopScope() {impl->setLooping(false);};
+
+			ReactorImplement*	impl; //!< Reactor implementation iterating
+		};
+
+	private:
+		//! @brief Get the nearest deadline among the timers, the idle timeouts and the drain (one of them must be pending)
+		Time getNextDeadline() const;
+		//! @brief Complete the drain if every handle is closed or if its deadline is reached
+		void checkDrain(Time const& now);
 
 	private:
-		ReactorImplement* mReactImplement; //!< Real reactor implementation (policy)
+		ReactorImplement*					mReactImplement; //!< Real reactor implementation (policy)
+		TimerQueue							mTimers; //!< Pending timers
+		IdleWheel							mIdle; //!< Idle timeouts
+		Time								mLoopLag; //!< Time spent dispatching the last events
+		bool								mIsLagTracked; //!< Whether the lag of the loop is measured
+		bool								mIsDraining; //!< Whether a drain is in progress
+		unsigned long						mDrainCount; //!< Number of drains completed
+		Time								mDrainStart; //!< Time at which the drain started
+		Time								mDrainDeadline; //!< Time at which the remaining handles are closed
+		DrainReport							mDrainReport; //!< Report of the last drain
+		LatencyHistogram					mReceiveLatency; //!< Latencies from the kernel reception to the handling
+		static NINA_THREAD_LOCAL Reactor*	msCurrent; //!< Reactor of the calling thread
 };
 
+template <class SYNC_POLICY> NINA_THREAD_LOCAL Reactor<SYNC_POLICY>* Reactor<SYNC_POLICY>::msCurrent;
+
 NINA_END_NAMESPACE_DECL
 
 # include "NinaReactor.imp"
@@ -45,10 +45,115 @@ Reactor<SYNC_POLICY>::removeHandler(NINAHandle handle, uint16_t eType)
 	return mReactImplement->removeHandler(handle, eType);
 }
 
+template <class SYNC_POLICY> NINA_INLINE long
+Reactor<SYNC_POLICY>::scheduleTimer(EventHandler* eHandler, Time const& delay)
+{
+	Time	deadline(mReactImplement->getLoopTime());
+
+	deadline += delay;
+	return mTimers.schedule(eHandler, deadline);
+}
+
+template <class SYNC_POLICY> NINA_INLINE int
+Reactor<SYNC_POLICY>::cancelTimer(long timerId)
+{
+	return mTimers.cancel(timerId);
+}
+
 template <class SYNC_POLICY> NINA_INLINE int
-Reactor<SYNC_POLICY>::handleEvents(Time const* timeout)
+Reactor<SYNC_POLICY>::trackIdle(EventHandler* eHandler, Time const& timeout)
+{
+	return mIdle.track(eHandler, timeout, mReactImplement->getLoopTime());
+}
+
+template <class SYNC_POLICY> NINA_INLINE int
+Reactor<SYNC_POLICY>::untrackIdle(EventHandler* eHandler)
+{
+	return mIdle.untrack(eHandler);
+}
+
+template <class SYNC_POLICY> NINA_INLINE int
+Reactor<SYNC_POLICY>::setIdleGranularity(Time const& granularity)
+{
+	return mIdle.setGranularity(granularity);
+}
+
+template <class SYNC_POLICY> NINA_INLINE Time const&
+Reactor<SYNC_POLICY>::now() const
+{
+	return mReactImplement->getLoopTime();
+}
+
+template <class SYNC_POLICY> NINA_INLINE void
+Reactor<SYNC_POLICY>::setCoarseClock(bool isCoarse)
+{
+	mReactImplement->setCoarseClock(isCoarse);
+}
+
+template <class SYNC_POLICY> NINA_INLINE void
+Reactor<SYNC_POLICY>::setLoopLagTracking(bool isTracked)
+{
+	mIsLagTracked = isTracked;
+}
+
+template <class SYNC_POLICY> NINA_INLINE Time const&
+Reactor<SYNC_POLICY>::getLoopLag() const
+{
+	return mLoopLag;
+}
+
+template <class SYNC_POLICY> NINA_INLINE size_t
+Reactor<SYNC_POLICY>::getHandleCount() const
+{
+	return mReactImplement->getHandleCount();
+}
+
+template <class SYNC_POLICY> NINA_INLINE void
+Reactor<SYNC_POLICY>::recordReceiveLatency(Time const& stamp)
+{
+	Time	current(0, 0);
+
+	if (stamp == Time::timeNull || current.timestamp() < 0)
+		return;
+	mReceiveLatency.record(current - stamp);
+}
+
+template <class SYNC_POLICY> NINA_INLINE LatencyHistogram const&
+Reactor<SYNC_POLICY>::getReceiveLatency() const
+{
+	return mReceiveLatency;
+}
+
+template <class SYNC_POLICY> NINA_INLINE void
+Reactor<SYNC_POLICY>::resetReceiveLatency()
+{
+	mReceiveLatency.reset();
+}
+
+template <class SYNC_POLICY> NINA_INLINE bool
+Reactor<SYNC_POLICY>::isDraining() const
+{
+	return mIsDraining;
+}
+
+template <class SYNC_POLICY> NINA_INLINE DrainReport const&
+Reactor<SYNC_POLICY>::getDrainReport() const
+{
+	return mDrainReport;
+}
+
+template <class SYNC_POLICY> NINA_INLINE Reactor<SYNC_POLICY>&
+Reactor<SYNC_POLICY>::getSingleton()
+{
+	NINA_ASSERT_SINGLETON(msCurrent, typeid(Reactor).name(), " in getSingleton");
+	return *msCurrent;
+}
+
+template <class SYNC_POLICY> NINA_INLINE Reactor<SYNC_POLICY>*
+Reactor<SYNC_POLICY>::getSingletonPtr()
 {
-	return mReactImplement->handleEvents(timeout);
+	NINA_ASSERT_SINGLETON(msCurrent, typeid(Reactor).name(), " in getSingletonPtr");
+	return msCurrent;
 }
 
 NINA_END_NAMESPACE_DECL
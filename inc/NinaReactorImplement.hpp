@@ -33,6 +33,7 @@
 # endif // !NINA_WIN32
 
 # include <map>
+# include <vector>
 # include <utility>
 # include "NinaTypes.hpp"
 # include "NinaEventHandler.hpp"
@@ -66,6 +67,8 @@ class NINA_DLLREQ ReactorImplement
 		typedef int (EventHandler::*Handler)(NINAHandle);
 
 	public:
+		ReactorImplement() : mNotifyTimeout(true), mLoopTime(0, 0), mIsLoopTimeValid(false),
+				mIsLooping(false), mIsCoarseClock(false) {};
 		virtual ~ReactorImplement() {};
 
 	public:
@@ -74,6 +77,58 @@ class NINA_DLLREQ ReactorImplement
 		virtual int removeHandler(EventHandler* eHandler, uint16_t eType) = 0;
 		virtual int removeHandler(NINAHandle handle, uint16_t eType) = 0;
 		virtual int handleEvents(Time const* timeout) = 0;
+		/*!
+		 * @brief Get the precision of the timeouts given to handleEvents in nanoseconds
+		 * @details Most backends wait with a precision of one millisecond, shorter remainders are truncated
+		 */
+		virtual int64_t getTimeoutPrecision() const {return Time::MSEC_IN_NSEC;};
+		//! @brief Set whether a wait reaching its timeout is dispatched to the EventHandlers (see EventHandler::handleTimeout)
+		void setTimeoutNotification(bool notify) {mNotifyTimeout = notify;};
+		/*!
+		 * @brief Get the time of the current loop iteration
+		 * @details The monotonic clock is read on the first request of an iteration, then cached until
+		 * the iteration ends. Outside of the iterations the clock is read on each request
+		 */
+		Time const& getLoopTime() const
+		{
+			if (mIsLoopTimeValid == false)
+				return updateLoopTime();
+			return mLoopTime;
+		}
+		//! @brief Read the clock again and cache the result as the time of the current loop iteration
+		Time const& updateLoopTime() const
+		{
+			mLoopTime.monotonic(mIsCoarseClock);
+			mIsLoopTimeValid = mIsLooping;
+			return mLoopTime;
+		}
+		//! @brief Forget the time of the current loop iteration, the next getLoopTime takes a new time
+		void resetLoopTime() {mIsLoopTimeValid = false;};
+		//! @brief Mark the start or the end of a loop iteration
+		void setLooping(bool isLooping) {mIsLooping = isLooping; mIsLoopTimeValid = false;};
+		//! @brief Set whether the coarse monotonic clock is used (see Time::monotonic)
+		void setCoarseClock(bool isCoarse) {mIsCoarseClock = isCoarse;};
+		//! @brief Check whether the time of the current loop iteration has been taken (namely events were dispatched)
+		bool hasLoopTime() const {return mIsLoopTimeValid;};
+		//! @brief Get the number of registered handles
+		size_t getHandleCount() const {return mTable.size();};
+		/*!
+		 * @brief Dispatch EventHandler::handleDrain to every registered handle
+		 * @details Handles which EventHandler returns -1 are removed then closed (see EventHandler::handleClose)
+		 * @return the number of handles closed at once
+		 */
+		size_t dispatchDrain()
+		{
+			return forEachHandle(&EventHandler::handleDrain);
+		}
+		/*!
+		 * @brief Remove then close every registered handle
+		 * @return the number of handles closed
+		 */
+		size_t closeAll()
+		{
+			return forEachHandle(0);
+		}
 	protected:
 		//! @brief Calls the appropriate member function depending on the event and resolves its errors
 		//! @return the handle which has to be skipped if there are no more events to be monitored or NINA_INVALID_HANDLE otherwise
@@ -83,6 +138,11 @@ class NINA_DLLREQ ReactorImplement
 			NINAHandle	handle;
 
 			handle = elem->first;
+			// The wait has been shortened by a timer, it is not an user timeout
+			if (event == Events::TIME_OUT && mNotifyTimeout == false)
+				return NINA_INVALID_HANDLE;
+			if (event == Events::READ || event == Events::WRITE || event == Events::URGENT)
+				elem->second.first->setLastActivity(getLoopTime());
 			switch (event) {
 				case Events::READ:
 					errCode = elem->second.first->handleRead(handle);
@@ -109,8 +169,42 @@ class NINA_DLLREQ ReactorImplement
 			return NINA_INVALID_HANDLE;
 		}
 
+	private:
+		/*!
+		 * @brief Call a member function on a snapshot of the registered handles
+		 * @details Handles unregistered in the meantime are skipped. If the function is null or returns -1,
+		 * the handle is removed then EventHandler::handleClose is called
+		 * @return the number of handles closed
+		 */
+		size_t forEachHandle(Handler handler)
+		{
+			std::vector<std::pair<NINAHandle, EventHandler*> >	handles;
+			DemuxTable::const_iterator							j;
+			size_t												count = 0;
+
+			for (DemuxTable::const_iterator i = mTable.begin(); i != mTable.end(); ++i)
+				handles.push_back(std::make_pair(i->first, i->second.first));
+			for (size_t i = 0; i < handles.size(); ++i) {
+				j = mTable.find(handles[i].first);
+				if (j == mTable.end() || j->second.first != handles[i].second)
+					continue;
+				if (handler != 0 && (handles[i].second->*handler)(handles[i].first) != -1)
+					continue;
+				removeHandler(handles[i].first, Events::ALL);
+				handles[i].second->handleClose(handles[i].first);
+				++count;
+			}
+			return count;
+		}
+
 	protected:
-		DemuxTable mTable; //!< Demuxing table necessary to manage events
+		DemuxTable	mTable; //!< Demuxing table necessary to manage events
+		bool		mNotifyTimeout; //!< Whether the timeouts are dispatched
+	private:
+		mutable Time	mLoopTime; //!< Time of the current loop iteration
+		mutable bool	mIsLoopTimeValid; //!< Whether mLoopTime has been taken during the current iteration
+		bool			mIsLooping; //!< Whether a loop iteration is running
+		bool			mIsCoarseClock; //!< Whether the coarse monotonic clock is used
 };
 
 NINA_END_NAMESPACE_DECL
@@ -0,0 +1,238 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaResolver.hpp
+ * @brief Defines the asynchronous name resolution of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_RESOLVER_HPP__
+# define __NINA_RESOLVER_HPP__
+
+# include <pthread.h>
+# include <deque>
+# include <list>
+# include <map>
+# include <string>
+# include <vector>
+# include "NinaDef.hpp"
+# include "NinaEventHandler.hpp"
+# include "NinaInetAddrList.hpp"
+# include "NinaCppUtils.hpp"
+# include "NinaTime.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class ResolveHandler
+ * @brief Completion interface of the asynchronous name resolution (see NINA::Resolver)
+ */
+class NINA_DLLREQ ResolveHandler
+{
+	public:
+		//! @brief Virtual destructor
+		virtual ~ResolveHandler() {}
+
+	public:
+		/*!
+		 * @brief Handle the completion of a lookup
+		 * @details It is called from the thread of the reactor the Resolver is registered with
+		 * @param[in] host : the name which was looked up
+		 * @param[in] addrs : the addresses of the host with the requested port, ordered for Connector::connect (empty on error)
+		 * @param[in] error : 0 on success or the error code of getaddrinfo (EAI_*, see gai_strerror)
+		 */
+		virtual void handleResolve(std::string const& host, InetAddrList const& addrs, int error) = 0;
+};
+
+/*! @class Resolver
+ * @brief Asynchronous name resolution
+ *
+ * @details getaddrinfo blocks for as long as the name servers take to answer, thus it must never be called
+ * from an event handler. The Resolver runs the lookups on a small pool of worker threads, then posts the
+ * results back through a pipe: once registered for read events with a reactor, the completions are
+ * dispatched from the thread of this reactor.<br/>
+ * Numeric addresses are converted at once, names are answered from an in-memory cache bounded in size
+ * (the least recently used entries are evicted) and in time. Unknown names (EAI_NONAME) are cached as well,
+ * for a shorter time, while transient failures are never cached.<br/>
+ * Concurrent lookups of the same name are coalesced into a single one.<br/>
+ * Example:
+ * @code
+ * NINA::Resolver	resolver;
+ *
+ * reactor.registerHandler(&resolver, NINA::Events::READ);
+ * resolver.resolve("example.org", 80, &handler);
+ * @endcode
+ * @warning The destructor waits for the lookups in progress to complete
+ */
+class NINA_DLLREQ Resolver : public EventHandler, public NonCopyable
+{
+	public:
+		enum
+		{
+			DEFAULT_WORKERS = 2, //!< Default number of worker threads
+			DEFAULT_CACHE_SIZE = 1024, //!< Default maximum number of cached names
+			DEFAULT_TTL = 60, //!< Default lifetime of the cached addresses in seconds
+			DEFAULT_NEGATIVE_TTL = 5 //!< Default lifetime of the cached unknown names in seconds
+		};
+
+	public:
+		/*!
+		 * @brief Constructor
+		 * @param[in] workers : number of worker threads running the lookups
+		 * @param[in] cacheSize : maximum number of cached names, 0 disables the cache
+		 * @throw NINA::Error::SystemError if the pipe or the threads could not be created
+		 */
+		Resolver(size_t workers = DEFAULT_WORKERS, size_t cacheSize = DEFAULT_CACHE_SIZE);
+		//! @brief Virtual destructor, the pending lookups are dropped without calling their handlers
+		virtual ~Resolver();
+
+	public:
+		//! @brief Handle the completion of lookups, their handlers are called
+		virtual int handleRead(NINAHandle handle);
+		//! @brief Handle write events (unused)
+		virtual int handleWrite(NINAHandle) {return 0;};
+		//! @brief Handle urgent events (unused)
+		virtual int handleUrgent(NINAHandle) {return 0;};
+		//! @brief Handle timeout events (unused)
+		virtual int handleTimeout(NINAHandle) {return 0;};
+		//! @brief Handle signal events (unused)
+		virtual int handleSignal(NINAHandle) {return 0;};
+		//! @brief Handle close events (unused)
+		virtual int handleClose(NINAHandle) {return 0;};
+		//! @brief Get the handle notifying the completion of lookups
+		virtual NINAHandle getHandle() const;
+		/*!
+		 * @brief Resolve the addresses of a host
+		 * @details Numeric addresses and cached names are answered at once, the handler is called before returning
+		 * @param[in] host : a numeric address or a name to look up
+		 * @param[in] port : port set on the resolved addresses
+		 * @param[in] handler : the handler called on completion
+		 * @param[in] family : the address family to resolve, AF_INET/AF_INET6/AF_UNSPEC
+		 * @param[in] protocol : protocol used for the connection, IPPROTO_* or InetAddr::ANY_PROTO
+		 * @return 1 if the handler has already been called, 0 if the lookup is in progress or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int resolve(std::string const& host, uint16_t port, ResolveHandler* handler,
+				int family = AF_UNSPEC, int protocol = IPPROTO_TCP);
+		//! @brief Forget all the lookups in progress of a handler, it won't be called anymore
+		void cancel(ResolveHandler* handler);
+		/*!
+		 * @brief Set the lifetime of the cached entries
+		 * @param[in] ttl : lifetime of the cached addresses, #DEFAULT_TTL seconds by default
+		 * @param[in] negativeTTL : lifetime of the cached unknown names, #DEFAULT_NEGATIVE_TTL seconds by default
+		 */
+		void setTTL(Time const& ttl, Time const& negativeTTL);
+		//! @brief Remove all the cached entries
+		void clearCache();
+		//! @brief Get the number of cached names
+		size_t getCacheCount() const;
+		//! @brief Get the number of names being looked up
+		size_t getPendingCount() const;
+		//! @brief Get the number of lookups run by the worker threads since the creation of the Resolver
+		size_t getLookupCount() const;
+		//! @brief Get the number of lookups answered by the cache since the creation of the Resolver
+		size_t getCacheHits() const;
+
+	protected:
+		/*!
+		 * @brief Look up a name
+		 * @details This function is called from the worker threads, it uses getaddrinfo by default
+		 * and may be overridden to plug another source of names (a stub resolver for instance)
+		 * @param[in] host : the name to look up
+		 * @param[in] protocol : protocol used for the connection
+		 * @param[in,out] addrs : the list to fill, built with the requested family (the port of the addresses is ignored)
+		 * @return 0 on success or an EAI_* error code
+		 */
+		virtual int lookup(std::string const& host, int protocol, InetAddrList& addrs);
+
+	private:
+		//! A name to resolve
+		struct Query
+		{
+			std::string	host; //!< Name to look up
+			int			family; //!< Address family requested
+			int			protocol; //!< Protocol requested
+
+			//! @brief Strict ordering of the queries
+			bool operator<(Query const& query) const;
+		};
+		//! A handler waiting for a lookup
+		struct Waiter
+		{
+			ResolveHandler*	handler; //!< Handler to call or 0 if it was cancelled
+			uint16_t		port; //!< Port to set on the addresses
+		};
+		//! A cached lookup
+		struct CacheEntry
+		{
+			CacheEntry() : addrs(AF_UNSPEC), error(0), expiry(0, 0) {}
+
+			InetAddrList						addrs; //!< Addresses resolved
+			int									error; //!< Error of the lookup
+			Time								expiry; //!< Time from which the entry is stale
+			std::list<Query>::iterator			lru; //!< Position in the recently used list
+		};
+		//! A lookup completed by a worker thread
+		struct Result
+		{
+			Result() : addrs(AF_UNSPEC), error(0) {}
+
+			Query			query; //!< Name looked up
+			InetAddrList	addrs; //!< Addresses resolved
+			int				error; //!< Error of the lookup
+		};
+		//! Cached lookups
+		typedef std::map<Query, CacheEntry> Cache;
+		//! Handlers waiting for each name being looked up
+		typedef std::map<Query, std::vector<Waiter> > WaitTable;
+
+	private:
+		//! @brief Entry point of the worker threads
+		static void* run(void* resolver);
+		//! @brief Run the lookups until the Resolver is destroyed
+		void work();
+		//! @brief Stop and join the worker threads then release the pipe
+		void stop();
+		//! @brief Find a fresh cache entry, the stale ones are removed
+		Cache::iterator findCache(Query const& query, Time const& now);
+		//! @brief Cache the result of a lookup, evicting the least recently used entry if needed
+		void storeCache(Result const& result, Time const& now);
+		//! @brief Call a handler with the addresses set to its port
+		void deliver(Query const& query, InetAddrList const& addrs, int error, Waiter const& waiter) const;
+
+	private:
+		std::vector<pthread_t>	mWorkers; //!< Worker threads
+		pthread_mutex_t			mLock; //!< Protects the queues shared with the worker threads
+		pthread_cond_t			mCond; //!< Signals new lookups to the worker threads
+		std::deque<Query>		mJobs; //!< Lookups to run
+		std::deque<Result>		mResults; //!< Lookups completed, not dispatched yet
+		bool					mIsStopped; //!< Whether the worker threads must exit
+		int						mPipe[2]; //!< Notifies the reactor of the completed lookups
+		WaitTable				mWaiting; //!< Handlers waiting for the names being looked up
+		std::vector<Waiter>*	mDispatching; //!< Handlers being called, if any
+		Cache					mCache; //!< Cached lookups
+		std::list<Query>		mLRU; //!< Cached queries, most recently used first
+		size_t					mCacheSize; //!< Maximum number of cached names
+		Time					mTTL; //!< Lifetime of the cached addresses
+		Time					mNegativeTTL; //!< Lifetime of the cached unknown names
+		size_t					mLookups; //!< Lookups run by the worker threads
+		size_t					mHits; //!< Lookups answered by the cache
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaResolver.inl"
+
+#endif // !__NINA_RESOLVER_HPP__
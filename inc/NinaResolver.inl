@@ -0,0 +1,78 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaResolver.inl
+ * @brief Implements the asynchronous name resolution of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE NINAHandle
+Resolver::getHandle() const
+{
+	return mPipe[0];
+}
+
+NINA_INLINE void
+Resolver::setTTL(Time const& ttl, Time const& negativeTTL)
+{
+	mTTL = ttl;
+	mNegativeTTL = negativeTTL;
+}
+
+NINA_INLINE void
+Resolver::clearCache()
+{
+	mCache.clear();
+	mLRU.clear();
+}
+
+NINA_INLINE size_t
+Resolver::getCacheCount() const
+{
+	return mCache.size();
+}
+
+NINA_INLINE size_t
+Resolver::getPendingCount() const
+{
+	return mWaiting.size();
+}
+
+NINA_INLINE size_t
+Resolver::getLookupCount() const
+{
+	return mLookups;
+}
+
+NINA_INLINE size_t
+Resolver::getCacheHits() const
+{
+	return mHits;
+}
+
+NINA_INLINE bool
+Resolver::Query::operator<(Query const& query) const
+{
+	if (family != query.family)
+		return family < query.family;
+	if (protocol != query.protocol)
+		return protocol < query.protocol;
+	return host < query.host;
+}
+
+NINA_END_NAMESPACE_DECL
@@ -31,6 +31,9 @@ NINA_INLINE void
 SAP::setHandle(NINAHandle handle)
 {
 	mTransportEndpoint = handle;
+	// The cached options belong to the previous endpoint
+	mIOFlags = -1;
+	mClFlag = -1;
 }
 
 NINA_END_NAMESPACE_DECL
@@ -54,6 +54,8 @@ class NINA_DLLREQ SelectPolicy : public ReactorImplement, public NonCopyable
 		virtual int removeHandler(NINAHandle handle, uint16_t eType);
 		//! @brief Process to the event handling
 		virtual int handleEvents(Time const* timeout = 0);
+		//! @brief Get the precision of the timeouts, select waits with a timeval
+		virtual int64_t getTimeoutPrecision() const {return Time::USEC_IN_NSEC;};
 
 	private:
 		fd_set	mReadSet; //!< Select specific data (read handle set)
@@ -0,0 +1,161 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaServiceAllocator.hpp
+ * @brief Defines the allocators of service handlers
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_SERVICEALLOCATOR_HPP__
+# define __NINA_SERVICEALLOCATOR_HPP__
+
+# include <vector>
+# include "NinaDef.hpp"
+# include "NinaCppUtils.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class NewAllocator
+ * @brief Default allocator of service handlers
+ *
+ * @details Each service handler is allocated with new and deleted once destroyed (see ServiceHandler::destroy)
+ * @arg SVC_HANDLER : the service to allocate (see NINA::ServiceHandler)
+ */
+template <class SVC_HANDLER>
+class NewAllocator
+{
+	public:
+		//! @brief Allocate a service handler
+		SVC_HANDLER* allocate() {return new SVC_HANDLER;};
+		//! @brief Release a service handler
+		void deallocate(SVC_HANDLER* serviceHandler) {delete serviceHandler;};
+};
+
+/*! @class RecycleAllocator
+ * @brief Allocator recycling the service handlers
+ *
+ * @details Destroyed service handlers are not deleted but kept constructed in a free list, up to a bounded size,
+ * and handed out again by the next allocations. This avoids the allocation of large handlers (such as handlers
+ * embedding their buffers) on each connection and the fragmentation of the heap<br/>
+ * When a handler is destroyed (see ServiceHandler::destroy) its peer is closed and ServiceHandler::reset is called,
+ * the handler must then be ready to serve a new connection<br/>
+ * The free list is not protected by any lock: each Acceptor owns its allocator, thus using one Acceptor per
+ * reactor thread gives a free list per thread. It is shared with the handlers in use, so that handlers outliving
+ * their allocator are deleted rather than recycled
+ * @warning Handlers must be destroyed from the thread of their Acceptor
+ * @arg SVC_HANDLER : the service to allocate (see NINA::ServiceHandler)
+ */
+template <class SVC_HANDLER>
+class RecycleAllocator
+{
+	public:
+		//! Default maximum number of free handlers
+		enum { DEFAULT_MAX_FREE = 1024 };
+
+	private:
+		class Node;
+
+		//! The free handlers, deleted along with the allocator or the last handler in use
+		class FreeList : public NonCopyable
+		{
+			public:
+				//! @brief Constructor, the allocator holds the list
+				FreeList(size_t maxFree) : mMaxFree(maxFree), mHolders(1), mIsOrphaned(false) {};
+
+			public:
+				//! @brief Hand out a free handler, or a new one if the list is empty
+				Node* pop();
+				//! @brief Take a handler back, keeping it if the list is not full
+				void push(Node* node);
+				//! @brief Set the maximum number of free handlers kept
+				void setMaxFree(size_t maxFree);
+				//! @brief Get the number of free handlers
+				size_t getSize() const {return mNodes.size();};
+				//! @brief Get the maximum number of free handlers kept
+				size_t getMaxFree() const {return mMaxFree;};
+				//! @brief Whether the allocator is gone, then the handlers in use are deleted once destroyed
+				bool isOrphaned() const {return mIsOrphaned;};
+				//! @brief Let the list go once its allocator is destroyed, the free handlers are deleted
+				void orphan() {mIsOrphaned = true; setMaxFree(0); drop();};
+				//! @brief Let the list go, it is deleted along with its last holder
+				void drop() {if (--mHolders == 0) delete this;};
+
+			private:
+				//! @brief Destructor, see drop
+				~FreeList() {};
+
+			private:
+				std::vector<Node*>	mNodes; //!< Free handlers
+				size_t				mMaxFree; //!< Maximum number of free handlers
+				size_t				mHolders; //!< Number of holders, the handlers in use and the allocator
+				bool				mIsOrphaned; //!< Whether the allocator is destroyed
+		};
+
+		//! A recycled handler, sending itself back to its free list on destruction
+		class Node : public SVC_HANDLER
+		{
+			public:
+				//! @brief Constructor
+				Node(FreeList* freeList) : SVC_HANDLER(), mFreeList(freeList) {};
+				//! @brief Give the handler back to its free list, or delete it if its allocator is gone
+				virtual void destroy();
+
+			private:
+				FreeList*	mFreeList; //!< Free list of the handler
+		};
+
+	public:
+		/*!
+		 * @brief Constructor
+		 * @param[in] maxFree : maximum number of free handlers kept, the others are deleted
+		 */
+		RecycleAllocator(size_t maxFree = DEFAULT_MAX_FREE);
+		//! @brief Destructor, the free handlers are deleted
+		~RecycleAllocator();
+		//! @brief Copy constructor (the free handlers are not copied)
+		RecycleAllocator(RecycleAllocator const& allocator);
+		//! @brief Assignement operator (the free handlers are not copied)
+		RecycleAllocator& operator=(RecycleAllocator const& allocator);
+
+	public:
+		//! @brief Allocate a service handler, reusing a free one if possible
+		SVC_HANDLER* allocate();
+		//! @brief Release a service handler, keeping it for a later allocation if the free list is not full
+		void deallocate(SVC_HANDLER* serviceHandler);
+		//! @brief Set the maximum number of free handlers kept
+		void setMaxFree(size_t maxFree);
+		//! @brief Get the number of free handlers
+		size_t getFreeCount() const;
+		//! @brief Get the number of allocations
+		unsigned long getAllocations() const;
+		//! @brief Get the number of allocations served by a free handler
+		unsigned long getReuses() const;
+		//! @brief Get the ratio of allocations served by a free handler
+		double getReuseRate() const;
+
+	private:
+		FreeList*		mFreeList; //!< Free handlers, shared with the handlers in use
+		unsigned long	mAllocations; //!< Number of allocations
+		unsigned long	mReuses; //!< Number of allocations served by a free handler
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaServiceAllocator.imp"
+# include "NinaServiceAllocator.inl"
+
+#endif /* !__NINA_SERVICEALLOCATOR_HPP__ */
@@ -0,0 +1,51 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaServiceAllocator.inl
+ * @brief Implements the allocators of service handlers (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+template <class SVC_HANDLER> NINA_INLINE size_t
+RecycleAllocator<SVC_HANDLER>::getFreeCount() const
+{
+	return mFreeList->getSize();
+}
+
+template <class SVC_HANDLER> NINA_INLINE unsigned long
+RecycleAllocator<SVC_HANDLER>::getAllocations() const
+{
+	return mAllocations;
+}
+
+template <class SVC_HANDLER> NINA_INLINE unsigned long
+RecycleAllocator<SVC_HANDLER>::getReuses() const
+{
+	return mReuses;
+}
+
+template <class SVC_HANDLER> NINA_INLINE double
+RecycleAllocator<SVC_HANDLER>::getReuseRate() const
+{
+	if (mAllocations == 0)
+		return 0;
+	return static_cast<double> (mReuses) / mAllocations;
+}
+
+NINA_END_NAMESPACE_DECL
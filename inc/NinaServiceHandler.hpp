@@ -25,9 +25,41 @@
 # include "NinaDef.hpp"
 # include "NinaEventHandler.hpp"
 # include "NinaSockStream.hpp"
+# include "NinaCppUtils.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
 
+/*! @class ConnectionCount
+ * @brief Number of live services of an Acceptor (see Acceptor::setMaxConnections)
+ *
+ * @details The count is shared by the Acceptor and the services it counts, it is deleted once all of them
+ * let it go, thus services may outlive their Acceptor
+ */
+class ConnectionCount : public NonCopyable
+{
+	public:
+		//! @brief Constructor, the creator holds the count
+		ConnectionCount() : mLive(0), mHolders(1) {};
+
+	public:
+		//! @brief Count a new live service, which holds the count
+		void acquire() {++mLive; ++mHolders;};
+		//! @brief Uncount a service ending, which lets the count go
+		void release() {--mLive; drop();};
+		//! @brief Let the count go, it is deleted along with its last holder
+		void drop() {if (--mHolders == 0) delete this;};
+		//! @brief Get the number of live services
+		size_t getLive() const {return mLive;};
+
+	private:
+		//! @brief Destructor, see drop
+		~ConnectionCount() {};
+
+	private:
+		size_t	mLive; //!< Number of live services
+		size_t	mHolders; //!< Number of holders, the live services and the Acceptor
+};
+
 /*! @class ServiceHandler
  * @brief An abstract class describing a service, useful for networked patterns
  *
@@ -43,10 +75,12 @@ class ServiceHandler : public EventHandler
 		//! Address class related to the IPC_STREAM<br/>
 		//! Note that the name _Addr isn't trivial, in fact all address classes descend from NINA::Addr
 		typedef typename IPC_STREAM::PeerAddr _Addr;
+		//! IPC stream class providing the endpoint of the service
+		typedef IPC_STREAM _Stream;
 
 	public:
-		//! @brief Virtual destructor
-		virtual ~ServiceHandler() {};
+		//! @brief Virtual destructor, the service stops being counted
+		virtual ~ServiceHandler() {detach();};
 	protected:
 		//! @brief Destructor
 		ServiceHandler();
@@ -72,16 +106,33 @@ class ServiceHandler : public EventHandler
 		 * judge whether an acceptation succeeded and has started a new service or if it has failed and must be aborted
 		 */
 		virtual int init() = 0;
+		/*!
+		 * @brief Destroy the service
+		 * @details Services must be destroyed through this function rather than deleted, so that the allocator
+		 * of the Acceptor may recycle them (see NINA::RecycleAllocator). By default the service is deleted
+		 */
+		virtual void destroy() {delete this;};
+		/*!
+		 * @brief Reset the service before it is recycled
+		 * @details This function is dedicated to the end user so that a recycled service starts as a new one
+		 * (see NINA::RecycleAllocator). The peer is already closed when it is called
+		 */
+		virtual void reset() {};
 		//! @brief Get the underlying IPC stream
 		//! @return A reference on an IPC_STREAM instance
 		IPC_STREAM& getPeer();
 		//! @brief Get the remote peer address we are connected to
 		//! @return A reference on an address instance associated to IPC_STREAM
 		_Addr& getRemoteAddr();
+		//! @brief Count the service among the connections of its Acceptor until it is destroyed or recycled
+		void attach(ConnectionCount* count);
+		//! @brief Stop counting the service, done by its destruction or its recycling (see NINA::RecycleAllocator)
+		void detach();
 
 	private:
-		IPC_STREAM	mIPCStream; //!< Service endpoint
-		_Addr		mIPCAddr; //!< Hold the remote peer address which is connected to our service endpoint
+		IPC_STREAM			mIPCStream; //!< Service endpoint
+		_Addr				mIPCAddr; //!< Hold the remote peer address which is connected to our service endpoint
+		ConnectionCount*	mCount; //!< Connections of the Acceptor counting the service, 0 if not counted
 };
 
 NINA_END_NAMESPACE_DECL
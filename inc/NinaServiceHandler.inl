@@ -40,4 +40,21 @@ ServiceHandler<IPC_STREAM>::getRemoteAddr()
 	return mIPCAddr;
 }
 
+template <class IPC_STREAM> NINA_INLINE void
+ServiceHandler<IPC_STREAM>::attach(ConnectionCount* count)
+{
+	detach();
+	mCount = count;
+	mCount->acquire();
+}
+
+template <class IPC_STREAM> NINA_INLINE void
+ServiceHandler<IPC_STREAM>::detach()
+{
+	if (mCount != 0) {
+		mCount->release();
+		mCount = 0;
+	}
+}
+
 NINA_END_NAMESPACE_DECL
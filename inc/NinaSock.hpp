@@ -71,10 +71,11 @@ class NINA_DLLREQ Sock : public SAP
 		 * @param[in] protocol : set a predefined protocol, #ANY_PROTO for a specific definiton by the operating system
 		 * @param[in] sockType : defines the socket type to use
 		 * @param[in] reuseAddr : set the transport endpoint to be reusable on the same port
+		 * @param[in] reusePort : allow several transport endpoints to be bound on the same address and port (SO_REUSEPORT)
 		 * @return 0 on success or -1 on error<br/>
 		 * If an error occured errno will be set accordingly
 		 */
-		int open(Addr const& addr, int family, int protocol, int sockType, bool reuseAddr = false);
+		int open(Addr const& addr, int family, int protocol, int sockType, bool reuseAddr = false, bool reusePort = false);
 		/*!
 		 * @brief Open and initialize a new transport endpoint
 		 * @throw NINA::Error::SystemError if an error occured
@@ -83,8 +84,10 @@ class NINA_DLLREQ Sock : public SAP
 		 * @param[in] protocol : set a predefined protocol, "any" for a specific definiton by the operating system
 		 * @param[in] sockType : defines the socket type to use
 		 * @param[in] reuseAddr : set the transport endpoint to be reusable on the same port
+		 * @param[in] reusePort : allow several transport endpoints to be bound on the same address and port (SO_REUSEPORT)
 		 */
-		void open(Addr const& addr, int family, std::string const& protocol, int sockType, bool reuseAddr = false);
+		void open(Addr const& addr, int family, std::string const& protocol, int sockType,
+				bool reuseAddr = false, bool reusePort = false);
 		/*!
 		 * @brief Close an existing endpoint
 		 * @return 0 on success or -1 on error<br/>
@@ -24,6 +24,7 @@
 
 # include "NinaSock.hpp"
 # include "NinaSockStream.hpp"
+# include "NinaSocketProfile.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
 
@@ -38,6 +39,8 @@ class NINA_DLLREQ SockAcceptor : public	Sock
 	public:
 		//! Address class to operate on peers
 		typedef InetAddr PeerAddr;
+		//! Stream class of the accepted peers
+		typedef SockStream PeerStream;
 
 	public:
 		//! @brief Constructor
@@ -57,10 +60,14 @@ class NINA_DLLREQ SockAcceptor : public	Sock
 		 * @param[in] protocol : protocol used by the handle
 		 * @param[in] reuseAddr : specify if the binding will be reusable before the 2MSL
 		 * @param[in] backlog : specify the backlog used by the SockAcceptor (length of the pending connections queue)
+		 * @param[in] reusePort : allow other SockAcceptors to listen on the same address, the kernel then balances
+		 * the incoming connections between them (see SockAcceptor::steerByCPU)
+		 * @param[in] profile : options set on the handle before it listens (see SocketProfile::applyListener)
 		 * @return 0 on success or -1 on error<br/>
 		 * If an error occured errno will be set accordingly
 		 */
-		int open(Addr const& addr, int family, int protocol, bool reuseAddr = false, int backlog = SOMAXCONN);
+		int open(Addr const& addr, int family, int protocol, bool reuseAddr = false, int backlog = SOMAXCONN,
+				bool reusePort = false, SocketProfile const* profile = 0);
 		/*!
 		 * @brief Open the handle allowing to manage incoming connections
 		 * @throw NINA::Error::SystemError if an error occured
@@ -69,16 +76,44 @@ class NINA_DLLREQ SockAcceptor : public	Sock
 		 * @param[in] protocol : protocol used by the handle
 		 * @param[in] reuseAddr : specify if the binding will be reusable before the 2MSL
 		 * @param[in] backlog : specify the backlog used by the SockAcceptor (length of the pending connections queue)
+		 * @param[in] reusePort : allow other SockAcceptors to listen on the same address, the kernel then balances
+		 * the incoming connections between them (see SockAcceptor::steerByCPU)
+		 * @param[in] profile : options set on the handle before it listens (see SocketProfile::applyListener)
 		 */
-		void open(Addr const& addr, int family, std::string const& protocol, bool reuseAddr = false, int backlog = SOMAXCONN);
+		void open(Addr const& addr, int family, std::string const& protocol, bool reuseAddr = false, int backlog = SOMAXCONN,
+				bool reusePort = false, SocketProfile const* profile = 0);
 		/*!
 		 * @brief Accept an incoming connection
 		 * @param[out] sock : a reference on a SockStream instance where the accepted peer handle will be stored
 		 * @param[out] peerAddr : if specified, it is filled in with the address of the connecting entity
+		 * @param[in] flags : options of the accepted handle, a bit set composed of SAP::NON_BLOCK/SAP::CLOSE_ON_EXEC<br/>
+		 * Where accept4 is available (see NINA_HAS_ACCEPT4) they are set atomically without any extra syscall
 		 * @return 0 on success or -1 on error<br/>
 		 * If an error occured errno will be set accordingly
 		 */
-		int accept(SockStream& sock, Addr* peerAddr = 0);
+		int accept(SockStream& sock, Addr* peerAddr = 0, uint8_t flags = 0);
+		/*!
+		 * @brief Steer the incoming connections of a reuse port group according to the receiving CPU
+		 * @details By default the kernel balances the connections of a group opened with reusePort using a hash
+		 * of the peers. This attaches a classic BPF program selecting the SockAcceptor (groupSize being the number of
+		 * SockAcceptors in the group) which index is the CPU handling the packet modulo groupSize.<br/>
+		 * Hence, when each SockAcceptor is served by a thread pinned on the matching CPU, connections are processed
+		 * where the network stack has handled them<br/>
+		 * The program is shared by the whole group, it only needs to be attached on one of its SockAcceptors
+		 * and the indexes follow the opening order
+		 * @param[in] groupSize : number of SockAcceptors in the group
+		 * @return 0 on success or -1 on error (ENOTSUP if SO_ATTACH_REUSEPORT_CBPF is not supported)<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int steerByCPU(unsigned int groupSize);
+		/*!
+		 * @brief Take over a handle which is already listening (e.g. received from another process)
+		 * @details The previous handle is closed. The handle is only owned on success
+		 * @param[in] handle : the listening handle
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly (NINA_BAD_ARG if the handle does not listen)
+		 */
+		int adopt(NINAHandle handle);
 };
 
 NINA_END_NAMESPACE_DECL
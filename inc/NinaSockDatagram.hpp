@@ -23,6 +23,8 @@
 # define __NINA_SOCKDATAGRAM_HPP__
 
 # include "NinaSockIO.hpp"
+# include "NinaDatagramBatch.hpp"
+# include "NinaInetAddr.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
 
@@ -82,6 +84,16 @@ class NINA_DLLREQ SockDatagram : public SockIO
 		 * If an error occured errno will be set accordingly
 		 */
 		int receiveFromPeer(std::string& str, Addr* peerAddr = 0, uint8_t flags = 0) const;
+		/*!
+		 * @brief Receive several datagrams at once along with the address of their senders
+		 * @details The datagrams already queued are received with a single system call where recvmmsg is available
+		 * (see #NINA_HAS_RECVMMSG), a single datagram is received otherwise. A blocking endpoint only waits for the first one
+		 * @param[out] batch : the batch to be filled (see DatagramBatch::getCount)
+		 * @param[in] flags : specify some modes to customize the reception, it can take the following flag : #UNCONSUMED
+		 * @return The number of datagrams received on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int receiveBatch(DatagramBatch& batch, uint8_t flags = 0) const;
 		/*!
 		 * @brief Send data to the transport endpoint at the address specified
 		 * @param[in] buf : buffer to be sent
@@ -141,6 +153,67 @@ class NINA_DLLREQ SockDatagram : public SockIO
 		 * @remark This function is equivalent to receiveFromPeer using the BUF_FULL flag
 		 */
 		int exactReceiveFromPeer(std::string& str, Addr* peerAddr = 0, uint8_t flags = 0) const;
+		//! @name Multicast
+		//! @{
+
+		/*!
+		 * @brief Join a multicast group
+		 * @details The protocol independent MCAST_JOIN_GROUP is used where available, IP_ADD_MEMBERSHIP/IPV6_JOIN_GROUP otherwise
+		 * @param[in] group : the address of the group (see InetAddr::isMulticast), its port is ignored
+		 * @param[in] ifIndex : index of the interface receiving the group, 0 to let the system choose it
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int joinGroup(InetAddr const& group, unsigned int ifIndex = 0) const;
+		//! @brief Leave a multicast group (see joinGroup above)
+		int leaveGroup(InetAddr const& group, unsigned int ifIndex = 0) const;
+		/*!
+		 * @brief Join a multicast group for the datagrams of a single source only (source-specific multicast)
+		 * @param[in] group : the address of the group (see InetAddr::isMulticast), its port is ignored
+		 * @param[in] source : the address of the source, of the same family as the group
+		 * @param[in] ifIndex : index of the interface receiving the group, 0 to let the system choose it
+		 * @return 0 on success or -1 on error (ENOTSUP if MCAST_JOIN_SOURCE_GROUP is not available)<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int joinSourceGroup(InetAddr const& group, InetAddr const& source, unsigned int ifIndex = 0) const;
+		//! @brief Leave a multicast group joined for a single source (see joinSourceGroup above)
+		int leaveSourceGroup(InetAddr const& group, InetAddr const& source, unsigned int ifIndex = 0) const;
+		/*!
+		 * @brief Set the time to live of the multicast datagrams sent (IP_MULTICAST_TTL/IPV6_MULTICAST_HOPS)
+		 * @param[in] hops : number of hops, 1 keeps the datagrams on the local network
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int setMulticastHops(int hops) const;
+		/*!
+		 * @brief Set whether the multicast datagrams sent are looped back to the local host (IP_MULTICAST_LOOP/IPV6_MULTICAST_LOOP)
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int setMulticastLoop(bool isEnabled) const;
+		/*!
+		 * @brief Set the interface the multicast datagrams are sent on (IP_MULTICAST_IF/IPV6_MULTICAST_IF)
+		 * @param[in] ifIndex : index of the interface, 0 to let the system choose it
+		 * @return 0 on success or -1 on error (ENOTSUP if IPv4 interfaces can not be set by index)<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int setMulticastInterface(unsigned int ifIndex) const;
+		/*!
+		 * @brief Set whether the destination address of the datagrams received is reported (IP_PKTINFO/IPV6_RECVPKTINFO)
+		 * @details It is reported by receiveBatch (see DatagramBatch::getDestAddr) where recvmmsg is available,
+		 * which tells apart the groups joined by a single socket
+		 * @return 0 on success or -1 on error (ENOTSUP if not supported)<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int setPacketInfo(bool isEnabled) const;
+		//! @}
+
+	private:
+		//! @brief Join or leave a group, for every source or a single one
+		int changeMembership(bool isJoining, InetAddr const& group, InetAddr const* source, unsigned int ifIndex) const;
+		//! @brief Get the level of the multicast options (IPPROTO_IP/IPPROTO_IPV6) according to the bound family
+		//! @return the level or -1 on error
+		int getMulticastLevel() const;
 };
 
 NINA_END_NAMESPACE_DECL
@@ -26,8 +26,34 @@
 # include "NinaSock.hpp"
 # include "NinaOS.hpp"
 
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251)
+# endif // !NINA_WIN32
+
+# include <vector>
+
 NINA_BEGIN_NAMESPACE_DECL
 
+/*! @struct SendTimestamp
+ * @brief Software timestamp of a send operation, collected from the error queue (see SockIO::receiveSendTimestamps)
+ */
+struct NINA_DLLREQ SendTimestamp
+{
+	enum Type
+	{
+		SENT, //!< The data left the host (SCM_TSTAMP_SND)
+		ACKNOWLEDGED //!< The data was acknowledged by the peer, streams only (SCM_TSTAMP_ACK)
+	};
+
+	SendTimestamp() : id(0), type(SENT), stamp(Time::timeNull) {};
+
+	uint32_t	id; //!< Identifier of the send: the offset of its last byte for streams, its number for datagrams (from 0)
+	Type		type; //!< Kind of the timestamp
+	Time		stamp; //!< Time of the event (a real time)
+};
+
 /*! @class SockIO
  * @brief Common socket Input/Output operations
  *
@@ -47,6 +73,11 @@ class NINA_DLLREQ SockIO : public Sock
 			BUF_FULL = MSG_WAITALL, //!< Wait until the buffer is fully filled
 			DONT_ROUTE = MSG_DONTROUTE //!< Only use the local network
 		};
+		enum
+		{
+			RX_TIMESTAMP = 1 << 0, //!< Timestamp the data received by the kernel
+			TX_TIMESTAMP = 1 << 1 //!< Timestamp the data sent, reported through the error queue
+		};
 
 	public:
 		//! @brief Virtual destructor
@@ -78,6 +109,17 @@ class NINA_DLLREQ SockIO : public Sock
 		 * If an error occured errno will be set accordingly
 		 */
 		int receive(std::string& str, uint8_t flags = 0) const;
+		/*!
+		 * @brief Receive data from the transport endpoint along with the time the kernel received it
+		 * @details For streams, the timestamp is the one of the last segment read
+		 * @param[out] buf : buffer to be filled
+		 * @param[in] bufLen : size of the buffer
+		 * @param[out] stamp : receive timestamp (a real time), Time::timeNull if it was not reported (see setTimestamping)
+		 * @param[in] flags : specify some modes to customize the reception, it is a bit set composed using the following flags : #UNCONSUMED/#BUF_FULL
+		 * @return The number of bytes received on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int receive(void* buf, size_t bufLen, Time& stamp, uint8_t flags = 0) const;
 		/*!
 		 * @brief Send data to the transport endpoint
 		 * @param[in] buf : buffer to be sent
@@ -95,6 +137,25 @@ class NINA_DLLREQ SockIO : public Sock
 		 * If an error occured errno will be set accordingly
 		 */
 		int send(std::string const& str, uint8_t flag = 0) const;
+		/*!
+		 * @brief Enable the software timestamps of the kernel
+		 * @details Receive timestamps are reported by receive and SockDatagram::receiveBatch. Send timestamps are queued
+		 * on the error queue, which wakes up the reactor handlers waiting for READ events, and are collected with
+		 * receiveSendTimestamps. They rely on SO_TIMESTAMPING (see #NINA_HAS_TIMESTAMPING)
+		 * @param[in] flags : bit set composed using the following flags : #RX_TIMESTAMP/#TX_TIMESTAMP, 0 disables the timestamps
+		 * @return 0 on success or -1 on error (ENOTSUP if not supported)<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int setTimestamping(uint8_t flags) const;
+		/*!
+		 * @brief Collect the send timestamps from the error queue, without blocking
+		 * @details The other messages of the error queue are consumed and ignored
+		 * @param[out] stamps : the timestamps are appended to it
+		 * @param[in] max : maximum number of messages to read from the error queue
+		 * @return The number of timestamps collected on success (0 if the queue was empty) or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int receiveSendTimestamps(std::vector<SendTimestamp>& stamps, size_t max = 64) const;
 };
 
 NINA_END_NAMESPACE_DECL
@@ -0,0 +1,156 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaSocketProfile.hpp
+ * @brief Defines the TCP tuning profiles of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_SOCKETPROFILE_HPP__
+# define __NINA_SOCKETPROFILE_HPP__
+
+# include "NinaDef.hpp"
+# include "NinaSock.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class SocketProfile
+ * @brief A set of TCP options applied at once
+ *
+ * @details A profile is given to SockAcceptor::open, Acceptor::open or Connector::setSocketProfile rather than
+ * setting each option by hand on every connection<br/>
+ * On Linux, accepted sockets inherit most of the options of their listening socket: these are only set once on the
+ * listening socket and an acceptance only sets the remaining ones (namely TCP_QUICKACK)<br/>
+ * Options left unset are not touched and options not supported by the system are ignored
+ */
+class NINA_DLLREQ SocketProfile
+{
+	public:
+		//! @brief Constructor, no option is set
+		SocketProfile();
+		//! @brief Destructor
+		~SocketProfile();
+		//! @brief Copy constructor
+		SocketProfile(SocketProfile const& profile);
+		//! @brief Assignement operator
+		SocketProfile& operator=(SocketProfile const& profile);
+
+	public:
+		/*!
+		 * @brief Profile for request/response traffic
+		 * @details Disables the Nagle algorithm and the delayed acknowledgments and bounds the unsent data
+		 * kept in the kernel so that the latest writes are not queued behind stale ones
+		 */
+		static SocketProfile lowLatency();
+		/*!
+		 * @brief Profile for bulk transfers
+		 * @details Keeps the Nagle algorithm, enlarges the socket buffers (which disables their automatic tuning)
+		 * and enables the keep alive probes for long lived transfers
+		 */
+		static SocketProfile bulkThroughput();
+
+	public:
+		//! @brief Set TCP_NODELAY, disabling the Nagle algorithm
+		SocketProfile& setNoDelay(bool enable);
+		//! @brief Set TCP_QUICKACK, disabling the delayed acknowledgments (Linux)
+		SocketProfile& setQuickAck(bool enable);
+		//! @brief Set TCP_DEFER_ACCEPT, connections are only accepted once data arrived or the timeout elapsed (Linux)
+		SocketProfile& setDeferAccept(int seconds);
+		//! @brief Set TCP_FASTOPEN on listening sockets with the given queue length, TCP_FASTOPEN_CONNECT on connecting ones
+		SocketProfile& setFastOpen(int queueLength);
+		//! @brief Set SO_RCVBUF
+		SocketProfile& setReceiveBuffer(int size);
+		//! @brief Set SO_SNDBUF
+		SocketProfile& setSendBuffer(int size);
+		//! @brief Set TCP_NOTSENT_LOWAT, the amount of unsent data above which the socket is not writable
+		SocketProfile& setNotSentLowat(int size);
+		//! @brief Set SO_BUSY_POLL, the time spent polling the device on blocking reads (Linux, may require privileges)
+		SocketProfile& setBusyPoll(int uSec);
+		//! @brief Set SO_KEEPALIVE
+		SocketProfile& setKeepAlive(bool enable);
+		/*!
+		 * @brief Apply the options to a socket which is about to listen
+		 * @details These are the listener options as well as the ones inherited by the accepted sockets
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int applyListener(Sock& sock) const;
+		/*!
+		 * @brief Apply the options which are not inherited to an accepted socket
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int applyAccepted(Sock& sock) const;
+		/*!
+		 * @brief Apply the options to a socket which is about to connect
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int applyConnector(Sock& sock) const;
+		//! @brief Check whether no option is set
+		bool isEmpty() const;
+
+	private:
+		//! Sockets an option applies to
+		enum Scope
+		{
+			LISTENER = 1, //!< Listening sockets
+			ACCEPTED = 2, //!< Accepted sockets
+			CONNECTOR = 4, //!< Connecting sockets
+# if defined (NINA_LINUX)
+			INHERITED = LISTENER //!< Options inherited by the accepted sockets (they are cloned from the listening one)
+# else
+			INHERITED = LISTENER | ACCEPTED //!< Options inherited by the accepted sockets
+# endif // !NINA_LINUX
+		};
+		//! Options of a profile
+		enum Option
+		{
+			NO_DELAY,
+			QUICK_ACK,
+			DEFER_ACCEPT,
+			FAST_OPEN,
+			RECEIVE_BUFFER,
+			SEND_BUFFER,
+			NOT_SENT_LOWAT,
+			BUSY_POLL,
+			KEEP_ALIVE,
+			OPTION_COUNT
+		};
+
+		//! Level, names and scope of an option
+		struct OptionInfo
+		{
+			int	level; //!< Level of the option
+			int	name; //!< Name of the option on listening and accepted sockets, -1 if unsupported
+			int	connectName; //!< Name of the option on connecting sockets, -1 if unsupported
+			int	scope; //!< Sockets the option applies to (see Scope)
+		};
+
+	private:
+		//! @brief Set the options applying to a scope
+		int apply(Sock& sock, Scope scope) const;
+
+	private:
+		int							mValues[OPTION_COUNT]; //!< Values of the options, -1 if unset
+		static OptionInfo const		msOptions[OPTION_COUNT]; //!< Options ordered as Option
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaSocketProfile.inl"
+
+#endif /* !__NINA_SOCKETPROFILE_HPP__ */
@@ -0,0 +1,105 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaSocketProfile.inl
+ * @brief Implements the TCP tuning profiles of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE SocketProfile&
+SocketProfile::setNoDelay(bool enable)
+{
+	mValues[NO_DELAY] = enable;
+	return *this;
+}
+
+NINA_INLINE SocketProfile&
+SocketProfile::setQuickAck(bool enable)
+{
+	mValues[QUICK_ACK] = enable;
+	return *this;
+}
+
+NINA_INLINE SocketProfile&
+SocketProfile::setDeferAccept(int seconds)
+{
+	mValues[DEFER_ACCEPT] = seconds;
+	return *this;
+}
+
+NINA_INLINE SocketProfile&
+SocketProfile::setFastOpen(int queueLength)
+{
+	mValues[FAST_OPEN] = queueLength;
+	return *this;
+}
+
+NINA_INLINE SocketProfile&
+SocketProfile::setReceiveBuffer(int size)
+{
+	mValues[RECEIVE_BUFFER] = size;
+	return *this;
+}
+
+NINA_INLINE SocketProfile&
+SocketProfile::setSendBuffer(int size)
+{
+	mValues[SEND_BUFFER] = size;
+	return *this;
+}
+
+NINA_INLINE SocketProfile&
+SocketProfile::setNotSentLowat(int size)
+{
+	mValues[NOT_SENT_LOWAT] = size;
+	return *this;
+}
+
+NINA_INLINE SocketProfile&
+SocketProfile::setBusyPoll(int uSec)
+{
+	mValues[BUSY_POLL] = uSec;
+	return *this;
+}
+
+NINA_INLINE SocketProfile&
+SocketProfile::setKeepAlive(bool enable)
+{
+	mValues[KEEP_ALIVE] = enable;
+	return *this;
+}
+
+NINA_INLINE int
+SocketProfile::applyListener(Sock& sock) const
+{
+	return apply(sock, LISTENER);
+}
+
+NINA_INLINE int
+SocketProfile::applyAccepted(Sock& sock) const
+{
+	return apply(sock, ACCEPTED);
+}
+
+NINA_INLINE int
+SocketProfile::applyConnector(Sock& sock) const
+{
+	return apply(sock, CONNECTOR);
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,88 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaTSCClock.hpp
+ * @brief Defines the time stamp counter clock of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_TSCCLOCK_HPP__
+# define __NINA_TSCCLOCK_HPP__
+
+# include "NinaDef.hpp"
+# include "NinaTime.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class TSCClock
+ * @brief Clock reading the time stamp counter of the processor
+ *
+ * @details Reading the counter costs a few nanoseconds, far less than a system call, which makes it suitable
+ * for sub-microsecond latency measurements. The ticks are converted to durations using a rate calibrated
+ * against the monotonic clock (see Time::monotonic).<br/>
+ * The counter is only used when it is invariant (constant rate, not stopped in deep sleep states),
+ * otherwise the ticks are the nanoseconds of the monotonic clock
+ * @warning The ticks are only meant to measure durations on the same machine
+ */
+class NINA_DLLREQ TSCClock
+{
+	public:
+		//! Default duration of the calibration in microseconds
+		enum { DEFAULT_CALIBRATION = 10000 };
+
+	public:
+		/*!
+		 * @brief Constructor
+		 * @details The clock is calibrated at once (see calibrate)
+		 */
+		TSCClock();
+		//! @brief Destructor
+		~TSCClock();
+		//! @brief Copy constructor
+		TSCClock(TSCClock const& clock);
+		//! @brief Assignment operator
+		TSCClock& operator=(TSCClock const& clock);
+
+	public:
+		//! @brief Check whether an invariant time stamp counter is available
+		static bool isSupported();
+		/*!
+		 * @brief Measure the rate of the counter against the monotonic clock
+		 * @details The calling thread busy waits for the whole duration, the longer the more accurate
+		 * @param[in] duration : duration of the measure
+		 * @return 0 on success or -1 on error
+		 */
+		int calibrate(Time const& duration = Time(0, DEFAULT_CALIBRATION));
+		//! @brief Read the clock
+		//! @return the number of ticks elapsed since an unspecified origin
+		uint64_t read() const;
+		//! @brief Convert a number of ticks into nanoseconds
+		uint64_t toNanoseconds(uint64_t ticks) const;
+		//! @brief Convert a number of ticks into a time value
+		Time toTime(uint64_t ticks) const;
+		//! @brief Get the calibrated rate of the clock in ticks per second
+		double getFrequency() const;
+
+	private:
+		bool	mIsTSC; //!< Whether the time stamp counter is read
+		double	mNSecPerTick; //!< Calibrated duration of a tick in nanoseconds
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaTSCClock.inl"
+
+#endif // !__NINA_TSCCLOCK_HPP__
@@ -0,0 +1,54 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaTSCClock.inl
+ * @brief Implements the time stamp counter clock of NINA api (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE uint64_t
+TSCClock::read() const
+{
+	Time	now(0, 0);
+
+#if defined (NINA_HAS_TSC)
+	uint32_t	low;
+	uint32_t	high;
+
+	if (mIsTSC == true) {
+		__asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+		return (static_cast<uint64_t> (high) << 32) | low;
+	}
+#endif // !NINA_HAS_TSC
+	now.monotonic();
+	return static_cast<uint64_t> (now.getNanoseconds());
+}
+
+NINA_INLINE uint64_t
+TSCClock::toNanoseconds(uint64_t ticks) const
+{
+	return static_cast<uint64_t> (static_cast<double> (ticks) * mNSecPerTick);
+}
+
+NINA_INLINE double
+TSCClock::getFrequency() const
+{
+	return 1e9 / mNSecPerTick;
+}
+
+NINA_END_NAMESPACE_DECL
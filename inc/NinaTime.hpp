@@ -32,19 +32,21 @@
 # endif // !NINA_WIN32
 
 # include <ctime>
-# include <cstring>
 
 NINA_BEGIN_NAMESPACE_DECL
 
 // Forward declaration
  NINA_BEGIN_NAMESPACE_OS
-int getCurrentTime(NINATimeval* tv);
+int getCurrentTime(int64_t* nSec);
+int getMonotonicTime(int64_t* nSec, bool coarse);
  NINA_END_NAMESPACE_OS
 
 /*! @class Time
  * @brief Encapsulates time specifications
  *
- * @details This class wrapped time representations in a partable manner
+ * @details This class wrapped time representations in a partable manner<br/>
+ * A time is a signed count of nanoseconds, which makes its arithmetic and its comparisons single integer
+ * operations. The seconds and the sub-second parts have the same sign and are truncated toward zero
  */
 class NINA_DLLREQ Time
 {
@@ -53,7 +55,9 @@ class NINA_DLLREQ Time
 		{
 			SEC_IN_USEC = 1000000, //!< One second in microseconds
 			SEC_IN_MSEC = 1000, //!< One second in milliseconds
+			SEC_IN_NSEC = 1000000000, //!< One second in nanoseconds
 			MSEC_IN_USEC = 1000, //!< One millisecond in microseconds
+			MSEC_IN_NSEC = 1000000, //!< One millisecond in nanoseconds
 			USEC_IN_NSEC = 1000 //!< One microsecond in nanoseconds
 		};
 
@@ -72,13 +76,13 @@ class NINA_DLLREQ Time
 		Time& operator=(Time const& time);
 
 	public:
-		//! @brief Get the underlying time representation
-		//! @return A pointer on a timeval structure
-		timeval const* getTimeval() const;
+		//! @brief Build a time from a number of nanoseconds
+		static Time fromNanoseconds(int64_t nSec);
+		//! @brief Convert the time to a timeval structure (truncated to the microsecond)
+		void getTimeval(timeval& tv) const;
 #if defined (NINA_POSIX)
-		//! @brief Get the underlying time representation
-		//! @return A pointer on a timespec structure
-		timespec const* getTimespec() const;
+		//! @brief Convert the time to a timespec structure
+		void getTimespec(timespec& ts) const;
 #endif // !NINA_POSIX
 		//! @brief Check for time equality	
 		bool operator==(Time const& time) const;
@@ -100,12 +104,12 @@ class NINA_DLLREQ Time
 		//! @param factor : factor of the multiplication
 		Time& operator*=(double factor);
 		//! @brief Add some time values
-		Time operator+(Time const& time);
+		Time operator+(Time const& time) const;
 		//! @brief Substract some time values
-		Time operator-(Time const& time);
+		Time operator-(Time const& time) const;
 		//! @brief Multiply a factor to a time value
 		//! @param factor : factor of the multiplication
-		Time operator*(double factor);
+		Time operator*(double factor) const;
 		//! @brief Increment the current time
 		//! @details The time is incremented with one second and one microsecond
 		void operator++();
@@ -118,12 +122,16 @@ class NINA_DLLREQ Time
 		 * @param[in] uSec : number of microseconds
 		 */
 		void set(time_t sec, long uSec);
+		//! @brief Set the time in nanoseconds
+		void setNanoseconds(int64_t nSec);
 		//! @brief Get the seconds used
 		//! @return Number of seconds used
 		time_t getSeconds() const;
 		//! @brief Get the microseconds used
-		//! @return Number of microseconds used
+		//! @return Number of microseconds used (below one second)
 		long getUSeconds() const;
+		//! @brief Get the whole time in nanoseconds
+		int64_t getNanoseconds() const;
 		/*!
 		 * @brief Get the current timestamp
 		 * @details This is actually the number of seconds and micro-seconds since January the 1st 1970
@@ -132,19 +140,20 @@ class NINA_DLLREQ Time
 		 * If an error occured errno will be set accordingly
 		 */
 		int timestamp();
-	private:
-		//! @brief Normalize the time by balancing seconds and microseconds
-		void normalize();
+		/*!
+		 * @brief Get the current time of a monotonic clock
+		 * @details Unlike timestamp, this time is never stepped by the adjustments of the system clock, thus it is
+		 * the one to use for deadlines and durations. Its origin is unspecified
+		 * @param[in] coarse : use a faster clock, only as precise as the scheduler tick (CLOCK_MONOTONIC_COARSE)
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int monotonic(bool coarse = false);
 
 	public:
 		static Time const timeNull; //!< Represents a time null
 	private:
-		OS::NINATimeval		mTimeValue; //!< Concrete time storage
-# if defined (NINA_WIN32)
-		mutable timeval		mExportTimeValue; //!< Transition container for time storage (Miscrosoft Windows)
-# else
-		mutable timespec	mTimeSpecValue; //!< Alternative concrete time storage
-# endif // !NINA_WIN32
+		int64_t		mNSec; //!< Concrete time storage in nanoseconds
 };
 
 NINA_END_NAMESPACE_DECL
@@ -21,100 +21,185 @@
 
 NINA_BEGIN_NAMESPACE_DECL
 
-NINA_INLINE timeval const*
-Time::getTimeval() const
+NINA_INLINE
+Time::Time(time_t sec, long uSec)
 {
-#if defined (NINA_WIN32)
-	//! @todo Requires valid truncation operations (see ACE::Truncate)
-	mExportTimeValue.tv_sec = static_cast<long> (mTimeValue.tv_sec);
-	mExportTimeValue.tv_usec = mTimeValue.tv_usec;
-	return &mExportTimeValue;
-#else
-	return &mTimeValue;
-#endif // !NINA_WIN32
+	set(sec, uSec);
+}
+
+NINA_INLINE
+Time::~Time()
+{
+}
+
+NINA_INLINE
+Time::Time(Time const& time)
+	: mNSec(time.mNSec)
+{
+}
+
+NINA_INLINE Time&
+Time::operator=(Time const& time)
+{
+	mNSec = time.mNSec;
+	return *this;
+}
+
+NINA_INLINE Time
+Time::fromNanoseconds(int64_t nSec)
+{
+	Time	time(0, 0);
+
+	time.mNSec = nSec;
+	return time;
+}
+
+NINA_INLINE void
+Time::getTimeval(timeval& tv) const
+{
+	tv.tv_sec = static_cast<long> (mNSec / SEC_IN_NSEC);
+	tv.tv_usec = static_cast<long> ((mNSec % SEC_IN_NSEC) / USEC_IN_NSEC);
 }
 
 #if defined (NINA_POSIX)
-NINA_INLINE timespec const*
-Time::getTimespec() const
+NINA_INLINE void
+Time::getTimespec(timespec& ts) const
 {
-	mTimeSpecValue.tv_sec = mTimeValue.tv_sec;
-	mTimeSpecValue.tv_nsec = mTimeValue.tv_usec * USEC_IN_NSEC;
-	return &mTimeSpecValue;
+	ts.tv_sec = static_cast<time_t> (mNSec / SEC_IN_NSEC);
+	ts.tv_nsec = static_cast<long> (mNSec % SEC_IN_NSEC);
 }
 #endif // !NINA_POSIX
 
 NINA_INLINE bool
 Time::operator==(Time const& time) const
 {
-	if (::memcmp(&mTimeValue, &time.mTimeValue, sizeof mTimeValue) == 0)
-		return true;
-	return false;
+	return mNSec == time.mNSec;
 }
 
 NINA_INLINE bool
 Time::operator!=(Time const& time) const
 {
-	if (::memcmp(&mTimeValue, &time.mTimeValue, sizeof mTimeValue) != 0)
-		return true;
-	return false;
+	return mNSec != time.mNSec;
 }
 
 NINA_INLINE bool
 Time::operator<(Time const& time) const
 {
-	if (::memcmp(&mTimeValue, &time.mTimeValue, sizeof mTimeValue) < 0)
-		return true;
-	return false;
+	return mNSec < time.mNSec;
 }
 
 NINA_INLINE bool
 Time::operator>(Time const& time) const
 {
-	if (::memcmp(&mTimeValue, &time.mTimeValue, sizeof mTimeValue) > 0)
-		return true;
-	return false;
+	return mNSec > time.mNSec;
 }
 
 NINA_INLINE bool
 Time::operator<=(Time const& time) const
 {
-	if (::memcmp(&mTimeValue, &time.mTimeValue, sizeof mTimeValue) <= 0)
-		return true;
-	return false;
+	return mNSec <= time.mNSec;
 }
 
 NINA_INLINE bool
 Time::operator>=(Time const& time) const
 {
-	if (::memcmp(&mTimeValue, &time.mTimeValue, sizeof mTimeValue) >= 0)
-		return true;
-	return false;
+	return mNSec >= time.mNSec;
+}
+
+NINA_INLINE Time&
+Time::operator+=(Time const& time)
+{
+	mNSec += time.mNSec;
+	return *this;
+}
+
+NINA_INLINE Time&
+Time::operator-=(Time const& time)
+{
+	mNSec -= time.mNSec;
+	return *this;
+}
+
+NINA_INLINE Time&
+Time::operator*=(double factor)
+{
+	mNSec = static_cast<int64_t> (static_cast<double> (mNSec) * factor);
+	return *this;
+}
+
+NINA_INLINE Time
+Time::operator+(Time const& time) const
+{
+	return fromNanoseconds(mNSec + time.mNSec);
+}
+
+NINA_INLINE Time
+Time::operator-(Time const& time) const
+{
+	return fromNanoseconds(mNSec - time.mNSec);
+}
+
+NINA_INLINE Time
+Time::operator*(double factor) const
+{
+	Time copy(*this);
+
+	copy *= factor;
+	return copy;
+}
+
+NINA_INLINE void
+Time::operator++()
+{
+	mNSec += static_cast<int64_t> (SEC_IN_NSEC) + USEC_IN_NSEC;
+}
+
+NINA_INLINE void
+Time::operator--()
+{
+	mNSec -= static_cast<int64_t> (SEC_IN_NSEC) + USEC_IN_NSEC;
 }
 
 NINA_INLINE void
 Time::set(time_t sec, long uSec)
 {
-	mTimeValue.tv_sec = sec;
-	mTimeValue.tv_usec = uSec;
+	mNSec = static_cast<int64_t> (sec) * SEC_IN_NSEC + static_cast<int64_t> (uSec) * USEC_IN_NSEC;
+}
+
+NINA_INLINE void
+Time::setNanoseconds(int64_t nSec)
+{
+	mNSec = nSec;
 }
 
 NINA_INLINE time_t
 Time::getSeconds() const
 {
-	return mTimeValue.tv_sec;
+	return static_cast<time_t> (mNSec / SEC_IN_NSEC);
 }
 
 NINA_INLINE long
 Time::getUSeconds() const
 {
-	return mTimeValue.tv_usec;
+	return static_cast<long> ((mNSec % SEC_IN_NSEC) / USEC_IN_NSEC);
+}
+
+NINA_INLINE int64_t
+Time::getNanoseconds() const
+{
+	return mNSec;
 }
 
 NINA_INLINE int
 Time::timestamp()
 {
-	return OS::getCurrentTime(&mTimeValue);
+	return OS::getCurrentTime(&mNSec);
+}
+
+NINA_INLINE int
+Time::monotonic(bool coarse)
+{
+	return OS::getMonotonicTime(&mNSec, coarse);
 }
 
 NINA_END_NAMESPACE_DECL
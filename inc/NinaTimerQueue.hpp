@@ -0,0 +1,101 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaTimerQueue.hpp
+ * @brief Defines the timer queue of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_TIMERQUEUE_HPP__
+# define __NINA_TIMERQUEUE_HPP__
+
+# include "NinaDef.hpp"
+
+# if defined (NINA_WIN32)
+// Disable: "<type> needs to have dll-interface to be used by clients'
+// Happens on STL member variables which are not public therefore is ok
+#  pragma warning(disable: 4251)
+# endif // !NINA_WIN32
+
+# include <map>
+# include <utility>
+# include "NinaTypes.hpp"
+# include "NinaCppUtils.hpp"
+# include "NinaTime.hpp"
+# include "NinaEventHandler.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class TimerQueue
+ * @brief One-shot timers ordered by deadline
+ *
+ * @details This class is used by NINA::Reactor to bound its waits and dispatch EventHandler::handleTimer
+ * once a deadline is reached<br/>
+ * Timers sharing the same deadline expire in the order they were scheduled
+ */
+class NINA_DLLREQ TimerQueue : public NonCopyable
+{
+	private:
+		//! Deadlines associated with their timer identifier
+		typedef std::multimap<Time, long> Deadlines;
+		//! Timer identifiers associated with their EventHandler and their position into the deadlines
+		typedef std::map<long, std::pair<EventHandler*, Deadlines::iterator> > Timers;
+
+	public:
+		//! @brief Constructor
+		TimerQueue();
+		//! @brief Destructor
+		~TimerQueue();
+
+	public:
+		/*!
+		 * @brief Schedule a timer
+		 * @param[in] eHandler : EventHandler notified through EventHandler::handleTimer
+		 * @param[in] deadline : absolute time of the expiration (see Time::timestamp)
+		 * @return the identifier of the timer or -1 on error
+		 */
+		long schedule(EventHandler* eHandler, Time const& deadline);
+		/*!
+		 * @brief Cancel a pending timer
+		 * @param[in] timerId : identifier returned by TimerQueue::schedule
+		 * @return 0 on success or -1 if the timer does not exist (already expired or cancelled)
+		 */
+		int cancel(long timerId);
+		/*!
+		 * @brief Dispatch the timers which deadline is reached
+		 * @details Timers scheduled by the EventHandlers during the dispatch are not processed until the next call<br/>
+		 * If EventHandler::handleTimer returns -1, EventHandler::handleClose is called
+		 * @param[in] now : the current time
+		 * @return the number of timers dispatched
+		 */
+		size_t expire(Time const& now);
+		//! @brief Check whether there are pending timers
+		bool isEmpty() const;
+		//! @brief Get the nearest deadline (the queue must not be empty)
+		Time const& getNextDeadline() const;
+
+	private:
+		Deadlines	mDeadlines; //!< Pending deadlines ordered by time
+		Timers		mTimers; //!< Pending timers
+		long		mNextId; //!< Identifier of the next timer
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaTimerQueue.inl"
+
+#endif /* !__NINA_TIMERQUEUE_HPP__ */
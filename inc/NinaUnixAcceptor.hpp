@@ -0,0 +1,83 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixAcceptor.hpp
+ * @brief Defines the passive connection establishment of the unix domain sockets
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_UNIXACCEPTOR_HPP__
+# define __NINA_UNIXACCEPTOR_HPP__
+
+# include "NinaSockAcceptor.hpp"
+# include "NinaUnixStream.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class UnixAcceptor
+ * @brief Unix domain passive connection establishment
+ *
+ * @details This class is a SockAcceptor listening on a NINA::UnixAddr, it plugs into NINA::Acceptor with
+ * SVC_HANDLERs built on NINA::UnixStream.<br/>
+ * A filesystem path outlives its socket: binding fails with EADDRINUSE until it is removed (see UnixAcceptor::remove).
+ * Names of the abstract namespace do not suffer from this
+ */
+class NINA_DLLREQ UnixAcceptor : public SockAcceptor
+{
+	public:
+		//! Address class to operate on peers
+		typedef UnixAddr PeerAddr;
+		//! Stream class of the accepted peers
+		typedef UnixStream PeerStream;
+
+	public:
+		//! @brief Constructor
+		UnixAcceptor();
+		//! @brief Destructor
+		~UnixAcceptor();
+		//! @brief Copy constructor
+		UnixAcceptor(UnixAcceptor const& sap);
+		//! @brief Assignement operator
+		UnixAcceptor& operator=(UnixAcceptor const& sap);
+
+	public:
+		/*!
+		 * @brief Open a listening transport endpoint
+		 * @details The family and the protocol are ignored as in UnixStream::open. SO_REUSEPORT does not apply
+		 * to the unix domain, neither do the TCP options of the profile
+		 * @param[in] addr : address on which the socket will be bound
+		 * @param[in] family : ignored, AF_UNIX is always used
+		 * @param[in] protocol : ignored, the default protocol is always used
+		 * @param[in] reuseAddr : ignored by the unix domain
+		 * @param[in] backlog : maximum length of the queue of pending connections
+		 * @param[in] reusePort : must be false
+		 * @param[in] profile : socket options (only the buffer sizes apply)
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int open(Addr const& addr, int family = AF_UNIX, int protocol = ANY_PROTO, bool reuseAddr = false,
+				int backlog = SOMAXCONN, bool reusePort = false, SocketProfile const* profile = 0);
+		/*!
+		 * @brief Close the endpoint then remove its path from the filesystem
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int remove();
+};
+
+NINA_END_NAMESPACE_DECL
+
+#endif // !__NINA_UNIXACCEPTOR_HPP__
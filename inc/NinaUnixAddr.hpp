@@ -0,0 +1,102 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixAddr.hpp
+ * @brief Defines the unix domain addressing
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_UNIXADDR_HPP__
+# define __NINA_UNIXADDR_HPP__
+
+# include "NinaDef.hpp"
+
+# include <string>
+# include <sys/socket.h>
+# include <sys/un.h>
+
+# include "NinaAddr.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class UnixAddr
+ * @brief Unix domain addressing
+ *
+ * @details This class defines the addresses of the AF_UNIX family, namely a filesystem path.<br/>
+ * On Linux, an address may also live in the abstract namespace: it is then a name which never appears
+ * on the filesystem and vanishes with the last socket bound to it.<br/>
+ * An address without any path is unnamed, as the one of an unbound socket or of a socket pair
+ */
+class NINA_DLLREQ UnixAddr : public Addr
+{
+	public:
+		//! @brief Constructor, the address is unnamed
+		UnixAddr();
+		/*!
+		 * @brief Constructor
+		 * @throw std::invalid_argument if the path does not fit in the address
+		 * @param[in] path : path of the socket on the filesystem, or its name in the abstract namespace
+		 * @param[in] abstract : whether the path is a name in the abstract namespace (Linux only)
+		 */
+		explicit UnixAddr(std::string const& path, bool abstract = false);
+		//! @brief Destructor
+		~UnixAddr();
+		//! @brief Copy constructor
+		UnixAddr(UnixAddr const& sap);
+		//! @brief Assignement operator
+		UnixAddr& operator=(UnixAddr const& sap);
+
+	public:
+		//! @brief Check for address equality
+		bool operator==(UnixAddr const& sap) const;
+		//! @brief Check for address inequality
+		bool operator!=(UnixAddr const& sap) const;
+		//! @brief Get a pointer on the concrete address
+		//! @return A pointer on a sockaddr_un structure
+		virtual void const* getAddr() const;
+		/*!
+		 * @brief Set the concrete address
+		 * @param[in] addr : a pointer on a sockaddr_un structure
+		 * @param[in] addrLen : size of the address pointed by addr (the path may be truncated by the system)
+		 * @return 0 on success or -1 on error
+		 */
+		virtual int setAddr(void* addr, size_t addrLen);
+		/*!
+		 * @brief Set the path of the address
+		 * @param[in] path : path of the socket on the filesystem, or its name in the abstract namespace
+		 * @param[in] abstract : whether the path is a name in the abstract namespace (Linux only)
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly (ENAMETOOLONG or ENOTSUP)
+		 */
+		int setPath(std::string const& path, bool abstract = false);
+		//! @brief Get the path of the address (without the leading null character of the abstract names)
+		std::string getPath() const;
+		//! @brief Check whether the address lives in the abstract namespace
+		bool isAbstract() const;
+		//! @brief Check whether the address has neither a path nor a name
+		bool isUnnamed() const;
+		//! @brief Reset the address to an unnamed one
+		virtual void reset();
+
+	private:
+		sockaddr_un		mUnixAddr; //!< Concrete address storage
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaUnixAddr.inl"
+
+#endif // !__NINA_UNIXADDR_HPP__
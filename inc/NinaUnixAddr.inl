@@ -0,0 +1,48 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixAddr.inl
+ * @brief Implements the unix domain addressing (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE bool
+UnixAddr::operator!=(UnixAddr const& sap) const
+{
+	return !(*this == sap);
+}
+
+NINA_INLINE void const*
+UnixAddr::getAddr() const
+{
+	return &mUnixAddr;
+}
+
+NINA_INLINE bool
+UnixAddr::isAbstract() const
+{
+	return mSize > static_cast<int> (offsetof(sockaddr_un, sun_path)) && mUnixAddr.sun_path[0] == '\0';
+}
+
+NINA_INLINE bool
+UnixAddr::isUnnamed() const
+{
+	return mSize <= static_cast<int> (offsetof(sockaddr_un, sun_path));
+}
+
+NINA_END_NAMESPACE_DECL
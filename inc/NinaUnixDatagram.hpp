@@ -0,0 +1,80 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixDatagram.hpp
+ * @brief Defines the unix domain datagram sockets
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_UNIXDATAGRAM_HPP__
+# define __NINA_UNIXDATAGRAM_HPP__
+
+# include "NinaSockDatagram.hpp"
+# include "NinaUnixAddr.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class UnixDatagram
+ * @brief Unix domain datagram socket
+ *
+ * @details This class is a SockDatagram bound to the AF_UNIX family, thus it only reaches the local host but skips
+ * the whole network stack. It keeps the interface of SockDatagram, PeerAddr being a NINA::UnixAddr
+ */
+class NINA_DLLREQ UnixDatagram : public SockDatagram
+{
+	public:
+		//! Defines the prefered class used for addressing
+		typedef UnixAddr PeerAddr;
+
+	public:
+		//! @brief Constructor
+		UnixDatagram();
+		//! @brief Destructor
+		~UnixDatagram();
+		//! @brief Copy constructor
+		UnixDatagram(UnixDatagram const& sap);
+		//! @brief Assignement operator
+		UnixDatagram& operator=(UnixDatagram const& sap);
+
+	public:
+		/*!
+		 * @brief Open and initialize a new transport endpoint
+		 * @details The unix domain only has one family and one protocol, thus family and protocol are ignored.
+		 * They are kept for the templates expecting the interface of SockDatagram
+		 * @param[in] addr : address on which the socket will be bound or Addr::sapAny if binding is not suitable
+		 * @param[in] family : ignored, AF_UNIX is always used
+		 * @param[in] protocol : ignored, the default protocol is always used
+		 * @param[in] reuseAddr : ignored by the unix domain
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int open(Addr const& addr, int family = AF_UNIX, int protocol = ANY_PROTO, bool reuseAddr = false);
+		/*!
+		 * @brief Create a pair of connected sockets
+		 * @details The sockets are unnamed, previous handles are closed
+		 * @param[out] first : the first end of the pair
+		 * @param[out] second : the second end of the pair
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		static int pair(UnixDatagram& first, UnixDatagram& second);
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaUnixDatagram.inl"
+
+#endif // !__NINA_UNIXDATAGRAM_HPP__
@@ -0,0 +1,118 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixStream.hpp
+ * @brief Defines the unix domain stream sockets
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#ifndef __NINA_UNIXSTREAM_HPP__
+# define __NINA_UNIXSTREAM_HPP__
+
+# include "NinaSockStream.hpp"
+# include "NinaUnixAddr.hpp"
+
+# include <vector>
+
+NINA_BEGIN_NAMESPACE_DECL
+
+/*! @class UnixStream
+ * @brief Unix domain stream socket
+ *
+ * @details This class is a SockStream bound to the AF_UNIX family, thus it only reaches the local host but skips
+ * the whole network stack. It keeps the interface of SockStream, PeerAddr being a NINA::UnixAddr
+ */
+class NINA_DLLREQ UnixStream : public SockStream
+{
+	public:
+		//! Defines the prefered class used for addressing
+		typedef UnixAddr PeerAddr;
+
+		enum
+		{
+			MAX_HANDLES = 253 //!< Maximum number of handles passed at once (SCM_MAX_FD of Linux)
+		};
+
+	public:
+		//! @brief Constructor
+		UnixStream();
+		//! @brief Destructor
+		~UnixStream();
+		//! @brief Copy constructor
+		UnixStream(UnixStream const& sap);
+		//! @brief Assignement operator
+		UnixStream& operator=(UnixStream const& sap);
+
+	public:
+		/*!
+		 * @brief Open and initialize a new transport endpoint
+		 * @details The unix domain only has one family and one protocol, thus family and protocol are ignored.
+		 * They are kept for the templates expecting the interface of SockStream
+		 * @param[in] addr : address on which the socket will be bound or Addr::sapAny if binding is not suitable
+		 * @param[in] family : ignored, AF_UNIX is always used
+		 * @param[in] protocol : ignored, the default protocol is always used
+		 * @param[in] reuseAddr : ignored by the unix domain
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int open(Addr const& addr, int family = AF_UNIX, int protocol = ANY_PROTO, bool reuseAddr = false);
+		/*!
+		 * @brief Create a pair of connected sockets
+		 * @details The sockets are unnamed, previous handles are closed
+		 * @param[out] first : the first end of the pair
+		 * @param[out] second : the second end of the pair
+		 * @return 0 on success or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		static int pair(UnixStream& first, UnixStream& second);
+		/*!
+		 * @brief Pass some handles to the peer process along with a payload (SCM_RIGHTS)
+		 * @details The peer receives duplicates of the handles, which remain open on this side.<br/>
+		 * This is the way a process hands its listening sockets (see Acceptor::adopt) or its live
+		 * connections over to another one, the payload carrying whatever state is needed to rebuild
+		 * their handlers (e.g. a dumped OutputPacket)
+		 * @param[in] handles : the handles to pass
+		 * @param[in] count : number of handles, at most #MAX_HANDLES
+		 * @param[in] buf : payload sent with the handles, it must hold at least one byte
+		 * @param[in] bufLen : size of the payload
+		 * @return the number of bytes of the payload sent or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int sendHandles(NINAHandle const* handles, size_t count, void const* buf, size_t bufLen) const;
+		//! @brief Pass some handles to the peer process along with a payload (see above)
+		int sendHandles(std::vector<NINAHandle> const& handles, std::string const& str) const;
+		/*!
+		 * @brief Receive the handles passed by the peer process along with their payload
+		 * @details The handles are close on exec, the caller owns them. Handles which do not fit
+		 * are closed by the system, the call then fails with EMSGSIZE
+		 * @param[out] handles : the handles received are appended
+		 * @param[out] buf : buffer receiving the payload
+		 * @param[in] bufLen : size of the buffer
+		 * @param[in] maxCount : maximum number of handles expected, at most #MAX_HANDLES
+		 * @return the number of bytes of the payload received or -1 on error<br/>
+		 * If an error occured errno will be set accordingly
+		 */
+		int receiveHandles(std::vector<NINAHandle>& handles, void* buf, size_t bufLen,
+				size_t maxCount = MAX_HANDLES) const;
+		//! @brief Receive the handles passed by the peer process, the payload is read up to the capacity of the string
+		int receiveHandles(std::vector<NINAHandle>& handles, std::string& str, size_t maxCount = MAX_HANDLES) const;
+};
+
+NINA_END_NAMESPACE_DECL
+
+# include "NinaUnixStream.inl"
+
+#endif // !__NINA_UNIXSTREAM_HPP__
@@ -0,0 +1,38 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixStream.inl
+ * @brief Implements the unix domain stream sockets (inline functions)
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NINA_INLINE int
+UnixStream::open(Addr const& addr, int family, int protocol, bool reuseAddr)
+{
+	NINA_UNUSED_ARG(family);
+	NINA_UNUSED_ARG(protocol);
+	return Sock::open(addr, AF_UNIX, ANY_PROTO, SOCK_STREAM, reuseAddr);
+}
+
+NINA_INLINE int
+UnixStream::sendHandles(std::vector<NINAHandle> const& handles, std::string const& str) const
+{
+	return sendHandles(handles.empty() ? 0 : &handles[0], handles.size(), str.data(), str.size());
+}
+
+NINA_END_NAMESPACE_DECL
@@ -16,10 +16,19 @@
 # include "NinaReactorImplement.hpp"
 # include "NinaEventHandler.hpp"
 # include "NinaEventHandlerAdapter.hpp"
+# include "NinaTimerQueue.hpp"
+# include "NinaIdleWheel.hpp"
+# include "NinaLatencyHistogram.hpp"
 
 // NINA Service handling
 # include "NinaServiceHandler.hpp"
+# include "NinaServiceAllocator.hpp"
 # include "NinaAcceptor.hpp"
+# include "NinaDatagramHandler.hpp"
+# include "NinaDatagramAcceptor.hpp"
+# include "NinaMulticastReceiver.hpp"
+# include "NinaConnector.hpp"
+# include "NinaConnectionPool.hpp"
 
 // NINA Socket wrapping
 # include "NinaSAP.hpp"
@@ -27,12 +36,27 @@
 # include "NinaSockAcceptor.hpp"
 # include "NinaSockConnector.hpp"
 # include "NinaSockDatagram.hpp"
+# include "NinaDatagramBatch.hpp"
 # include "NinaSockIO.hpp"
 # include "NinaSockStream.hpp"
+# include "NinaSocketProfile.hpp"
+# if defined (NINA_POSIX)
+#  include "NinaUnixStream.hpp"
+#  include "NinaUnixDatagram.hpp"
+#  include "NinaUnixAcceptor.hpp"
+# endif // !NINA_POSIX
 
 // NINA Addressing
 # include "NinaAddr.hpp"
 # include "NinaInetAddr.hpp"
+# include "NinaInetAddrList.hpp"
+# include "NinaInetAddrKey.hpp"
+# include "NinaInetAddrMap.hpp"
+# include "NinaNetTables.hpp"
+# if defined (NINA_POSIX)
+#  include "NinaUnixAddr.hpp"
+#  include "NinaResolver.hpp"
+# endif // !NINA_POSIX
 
 // NINA Policies
 # if defined (NINA_LINUX)
@@ -46,9 +70,13 @@
 // NINA Packets
 # include "NinaPacket.hpp"
 # include "NinaPacketFactory.hpp"
+# include "NinaMarshal.hpp"
+# include "NinaGatherPacket.hpp"
+# include "NinaCRC32C.hpp"
 
 // NINA Time
 # include "NinaTime.hpp"
+# include "NinaTSCClock.hpp"
 
 // NINA Container
 # include "NinaIOContainer.hpp"
@@ -0,0 +1,168 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaCRC32C.cpp
+ * @brief Implements the CRC32C checksum of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <cstring>
+#include "NinaCRC32C.hpp"
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+# define NINA_CRC32C_SSE42
+#elif defined (__ARM_FEATURE_CRC32)
+# define NINA_CRC32C_ARMV8
+# include <arm_acle.h>
+#endif // !NINA_CRC32C_SSE42 || NINA_CRC32C_ARMV8
+
+NINA_BEGIN_NAMESPACE_DECL
+
+namespace
+{
+	//! Reversed Castagnoli polynomial
+	uint32_t const	POLYNOMIAL = 0x82F63B78;
+
+	//! Slice-by-8 lookup tables
+	uint32_t		sTables[8][256];
+
+	typedef uint32_t (*Implementation)(uint32_t crc, unsigned char const* data, size_t len);
+
+	uint32_t
+	computeSoftware(uint32_t crc, unsigned char const* data, size_t len)
+	{
+		uint32_t	lo;
+		uint32_t	hi;
+
+		while (len > 0 && (reinterpret_cast<size_t> (data) & 7) != 0) {
+			crc = sTables[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+			--len;
+		}
+		while (len >= 8) {
+			lo = crc ^ (data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t> (data[3]) << 24));
+			hi = data[4] | (data[5] << 8) | (data[6] << 16) | (static_cast<uint32_t> (data[7]) << 24);
+			crc = sTables[7][lo & 0xFF] ^ sTables[6][(lo >> 8) & 0xFF] ^
+				sTables[5][(lo >> 16) & 0xFF] ^ sTables[4][lo >> 24] ^
+				sTables[3][hi & 0xFF] ^ sTables[2][(hi >> 8) & 0xFF] ^
+				sTables[1][(hi >> 16) & 0xFF] ^ sTables[0][hi >> 24];
+			data += 8;
+			len -= 8;
+		}
+		while (len-- > 0)
+			crc = sTables[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+		return crc;
+	}
+
+#if defined (NINA_CRC32C_SSE42)
+	__attribute__((target("sse4.2"))) uint32_t
+	computeHardware(uint32_t crc, unsigned char const* data, size_t len)
+	{
+		while (len > 0 && (reinterpret_cast<size_t> (data) & 7) != 0) {
+			crc = __builtin_ia32_crc32qi(crc, *data++);
+			--len;
+		}
+# if defined (__x86_64__)
+		uint64_t	crc64 = crc;
+		uint64_t	word;
+
+		while (len >= 8) {
+			std::memcpy(&word, data, sizeof(word));
+			crc64 = __builtin_ia32_crc32di(crc64, word);
+			data += 8;
+			len -= 8;
+		}
+		crc = static_cast<uint32_t> (crc64);
+# else
+		uint32_t	word;
+
+		while (len >= 4) {
+			std::memcpy(&word, data, sizeof(word));
+			crc = __builtin_ia32_crc32si(crc, word);
+			data += 4;
+			len -= 4;
+		}
+# endif // !__x86_64__
+		while (len-- > 0)
+			crc = __builtin_ia32_crc32qi(crc, *data++);
+		return crc;
+	}
+#elif defined (NINA_CRC32C_ARMV8)
+	uint32_t
+	computeHardware(uint32_t crc, unsigned char const* data, size_t len)
+	{
+		uint64_t	word;
+
+		while (len > 0 && (reinterpret_cast<size_t> (data) & 7) != 0) {
+			crc = __crc32cb(crc, *data++);
+			--len;
+		}
+		while (len >= 8) {
+			std::memcpy(&word, data, sizeof(word));
+			crc = __crc32cd(crc, word);
+			data += 8;
+			len -= 8;
+		}
+		while (len-- > 0)
+			crc = __crc32cb(crc, *data++);
+		return crc;
+	}
+#endif // !NINA_CRC32C_SSE42 || NINA_CRC32C_ARMV8
+
+	Implementation
+	selectImplementation()
+	{
+		uint32_t crc;
+
+		for (uint32_t i = 0; i < 256; ++i) {
+			crc = i;
+			for (int j = 0; j < 8; ++j)
+				crc = (crc >> 1) ^ ((crc & 1) ? POLYNOMIAL : 0);
+			sTables[0][i] = crc;
+		}
+		for (uint32_t i = 0; i < 256; ++i)
+			for (int k = 1; k < 8; ++k)
+				sTables[k][i] = (sTables[k - 1][i] >> 8) ^ sTables[0][sTables[k - 1][i] & 0xFF];
+#if defined (NINA_CRC32C_SSE42)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("sse4.2"))
+			return &computeHardware;
+#elif defined (NINA_CRC32C_ARMV8)
+		return &computeHardware;
+#endif // !NINA_CRC32C_SSE42 || NINA_CRC32C_ARMV8
+		return &computeSoftware;
+	}
+
+	// Selected once at load time, before any thread can be spawned
+	Implementation	sImplementation = selectImplementation();
+}
+
+uint32_t
+CRC32C::compute(void const* data, size_t len, uint32_t crc)
+{
+	if (sImplementation == 0) // Used during static initialization
+		sImplementation = selectImplementation();
+	return ~(*sImplementation)(~crc, static_cast<unsigned char const*> (data), len);
+}
+
+bool
+CRC32C::isHardwareAccelerated()
+{
+	if (sImplementation == 0)
+		sImplementation = selectImplementation();
+	return (sImplementation != &computeSoftware);
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,86 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaDatagramBatch.cpp
+ * @brief Implements the batches of received datagrams of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <cstring>
+#include "NinaDatagramBatch.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+DatagramBatch::DatagramBatch(size_t capacity, size_t datagramSize)
+	: mDatagramSize(0),
+	mCount(0)
+{
+	allocate(capacity, datagramSize);
+}
+
+DatagramBatch::~DatagramBatch()
+{
+}
+
+DatagramBatch::DatagramBatch(DatagramBatch const& batch)
+	: mDatagramSize(0),
+	mCount(0)
+{
+	allocate(batch.getCapacity(), batch.mDatagramSize);
+}
+
+DatagramBatch&
+DatagramBatch::operator=(DatagramBatch const& batch)
+{
+	// The message headers point into the buffers, thus they are never copied
+	if (this != &batch)
+		allocate(batch.getCapacity(), batch.mDatagramSize);
+	return *this;
+}
+
+void
+DatagramBatch::allocate(size_t capacity, size_t datagramSize)
+{
+	if (capacity == 0)
+		capacity = 1;
+	if (datagramSize == 0)
+		datagramSize = 1;
+	mDatagramSize = datagramSize;
+	mCount = 0;
+	mBuffer.assign(capacity * datagramSize, '\0');
+	mAddrs.resize(capacity);
+	mSizes.assign(capacity, 0);
+	mAddrLens.assign(capacity, 0);
+	mDests.resize(capacity);
+	mDestLens.assign(capacity, 0);
+	mStamps.assign(capacity, Time::timeNull);
+#if defined (NINA_HAS_RECVMMSG)
+	mHeaders.resize(capacity);
+	mVectors.resize(capacity);
+	mControls.assign(capacity * CONTROL_SIZE, '\0');
+	::memset(&mHeaders[0], 0, capacity * sizeof(mmsghdr));
+	for (size_t i = 0; i < capacity; ++i) {
+		mVectors[i].iov_base = &mBuffer[i * datagramSize];
+		mVectors[i].iov_len = datagramSize;
+		mHeaders[i].msg_hdr.msg_iov = &mVectors[i];
+		mHeaders[i].msg_hdr.msg_iovlen = 1;
+		mHeaders[i].msg_hdr.msg_name = &mAddrs[i];
+		mHeaders[i].msg_hdr.msg_control = &mControls[i * CONTROL_SIZE];
+	}
+#endif // !NINA_HAS_RECVMMSG
+}
+
+NINA_END_NAMESPACE_DECL
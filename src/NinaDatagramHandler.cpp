@@ -0,0 +1,109 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaDatagramHandler.cpp
+ * @brief Implements the datagram sessions of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include "NinaDatagramHandler.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+DatagramPeer::DatagramPeer()
+	: mSock(0)
+{
+}
+
+DatagramPeer::~DatagramPeer()
+{
+}
+
+DatagramPeer::DatagramPeer(DatagramPeer const& peer)
+	: mSock(peer.mSock),
+	mAddr(peer.mAddr),
+	mKey(peer.mKey)
+{
+}
+
+DatagramPeer&
+DatagramPeer::operator=(DatagramPeer const& peer)
+{
+	if (this != &peer) {
+		mSock = peer.mSock;
+		mAddr = peer.mAddr;
+		mKey = peer.mKey;
+	}
+	return *this;
+}
+
+int
+DatagramPeer::open(SockDatagram const* sock, void const* addr, int addrLen)
+{
+	mSock = 0;
+	if (sock == 0 || addrLen < 0 || mKey.set(addr, addrLen) < 0)
+		return -1;
+	if (mAddr.setAddr(const_cast<void*> (addr), addrLen) < 0)
+		return -1;
+	mSock = sock;
+	return 0;
+}
+
+int
+DatagramPeer::send(void const* buf, size_t bufLen, uint8_t flag) const
+{
+	if (mSock == 0) {
+		OS::setLastError(NINA_BAD_ARG);
+		return -1;
+	}
+	return mSock->sendToPeer(buf, bufLen, mAddr, flag);
+}
+
+DatagramHandler::DatagramHandler()
+	: EventHandler(),
+	mOwner(0)
+{
+}
+
+DatagramHandler::DatagramHandler(DatagramHandler const& handler)
+	: EventHandler(handler),
+	mPeer(handler.mPeer),
+	mOwner(0)
+{
+}
+
+DatagramHandler&
+DatagramHandler::operator=(DatagramHandler const& handler)
+{
+	// A copy does not belong to the table of the original
+	if (this != &handler)
+		mPeer = handler.mPeer;
+	return *this;
+}
+
+int
+DatagramHandler::handleClose(NINAHandle)
+{
+	Owner*	owner = mOwner;
+
+	// The owner destroys the handler, thus nothing is touched afterwards
+	mOwner = 0;
+	if (owner != 0)
+		owner->release(this);
+	return 0;
+}
+
+NINA_END_NAMESPACE_DECL
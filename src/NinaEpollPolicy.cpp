@@ -27,9 +27,19 @@
 #include "NinaEpollPolicy.hpp"
 #include "NinaOS.hpp"
 
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+
 NINA_BEGIN_NAMESPACE_DECL
 
 EpollPolicy::EpollPolicy()
+	: mTimerFd(-1),
+#if defined (SYS_epoll_pwait2)
+	mHasPwait2(true)
+#else
+	mHasPwait2(false)
+#endif // !SYS_epoll_pwait2
 {
 	mOpenMax = OS::getOpenMax();
 	mFdQueue = ::epoll_create(1);
@@ -42,6 +52,8 @@ EpollPolicy::EpollPolicy()
 EpollPolicy::~EpollPolicy()
 {
 	delete[] mFdSet;
+	if (mTimerFd != -1)
+		::close(mTimerFd);
 	::close(mFdQueue);
 }
 
@@ -113,12 +125,9 @@ int
 EpollPolicy::handleEvents(Time const* timeout)
 {
 	int							errCode;
-	int							time;
 	DemuxTableElement const*	elem;
 
-	time = (timeout == 0) ? -1 : timeout->getSeconds() * Time::SEC_IN_MSEC +
-								timeout->getUSeconds() / Time::MSEC_IN_USEC;	
-	errCode = ::epoll_wait(mFdQueue, mFdSet, mOpenMax, time);
+	errCode = wait(timeout);
 	if (errCode == NINA_ENDPOINT_ERROR && errno != EINTR)
 		return -1;
 	for (int n = 0; n < errCode; ++n)
@@ -152,4 +161,75 @@ EpollPolicy::handleEvents(Time const* timeout)
 	return 0;
 }
 
+int
+EpollPolicy::wait(Time const* timeout)
+{
+	int64_t		nSec;
+#if defined (SYS_epoll_pwait2)
+	timespec	time;
+	int			errCode;
+#endif // !SYS_epoll_pwait2
+
+	if (timeout == 0)
+		return ::epoll_wait(mFdQueue, mFdSet, mOpenMax, -1);
+	nSec = timeout->getNanoseconds();
+	if (nSec <= 0)
+		return ::epoll_wait(mFdQueue, mFdSet, mOpenMax, 0);
+	if (nSec % Time::MSEC_IN_NSEC == 0)
+		return ::epoll_wait(mFdQueue, mFdSet, mOpenMax, static_cast<int> (nSec / Time::MSEC_IN_NSEC));
+#if defined (SYS_epoll_pwait2)
+	// Called through syscall since the wrapper is only provided by recent C libraries
+	if (mHasPwait2 == true) {
+		timeout->getTimespec(time);
+		errCode = static_cast<int> (::syscall(SYS_epoll_pwait2, mFdQueue, mFdSet, static_cast<int> (mOpenMax), &time, 0, 0));
+		if (errCode != -1 || errno != ENOSYS)
+			return errCode;
+		mHasPwait2 = false;
+	}
+#endif // !SYS_epoll_pwait2
+	return waitTimer(*timeout);
+}
+
+int
+EpollPolicy::waitTimer(Time const& timeout)
+{
+	itimerspec	spec;
+	epoll_event	event;
+	uint64_t	expirations;
+	int			errCode;
+
+	if (mTimerFd == -1) {
+		mTimerFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+		event.data.ptr = 0;
+		event.events = EPOLLIN;
+		if (mTimerFd != -1 && ::epoll_ctl(mFdQueue, EPOLL_CTL_ADD, mTimerFd, &event) == -1) {
+			::close(mTimerFd);
+			mTimerFd = -1;
+		}
+		// Without timer the wait is rounded up to the millisecond
+		if (mTimerFd == -1)
+			return ::epoll_wait(mFdQueue, mFdSet, mOpenMax,
+					static_cast<int> (timeout.getNanoseconds() / Time::MSEC_IN_NSEC + 1));
+	}
+	::memset(&spec, 0, sizeof(spec));
+	timeout.getTimespec(spec.it_value);
+	if (::timerfd_settime(mTimerFd, 0, &spec, 0) == -1)
+		return -1;
+	errCode = ::epoll_wait(mFdQueue, mFdSet, mOpenMax, -1);
+	// Disarm the timer and consume its expiration if any
+	::memset(&spec, 0, sizeof(spec));
+	::timerfd_settime(mTimerFd, 0, &spec, 0);
+	if (::read(mTimerFd, &expirations, sizeof(expirations)) < 0)
+		expirations = 0;
+	// The timer is not a registered handle, its event is dropped (a wait woken by it only is a timeout)
+	for (int n = 0; n < errCode; ++n) {
+		if (mFdSet[n].data.ptr == 0) {
+			mFdSet[n] = mFdSet[errCode - 1];
+			--errCode;
+			break;
+		}
+	}
+	return errCode;
+}
+
 NINA_END_NAMESPACE_DECL
@@ -0,0 +1,92 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaGatherPacket.cpp
+ * @brief Implements the scatter-gather output packets of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include "NinaGatherPacket.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+GatherPacket::GatherPacket(size_t blobThreshold, CDR::Encoding encoding)
+	: mBlobThreshold(blobThreshold),
+	mEncoding(encoding),
+	mByteOrder(CDR::NETWORK_ORDER)
+{
+}
+
+GatherPacket::GatherPacket(GatherPacket const& gpack)
+	: mHeaders(gpack.mHeaders),
+	mSegments(gpack.mSegments),
+	mBlobThreshold(gpack.mBlobThreshold),
+	mEncoding(gpack.mEncoding),
+	mByteOrder(gpack.mByteOrder)
+{
+}
+
+GatherPacket&
+GatherPacket::operator=(GatherPacket const& gpack)
+{
+	if (this != &gpack) {
+		mHeaders = gpack.mHeaders;
+		mSegments = gpack.mSegments;
+		mBlobThreshold = gpack.mBlobThreshold;
+		mEncoding = gpack.mEncoding;
+		mByteOrder = gpack.mByteOrder;
+	}
+	return *this;
+}
+
+void
+GatherPacket::fill(IOContainer& ioc) const
+{
+	for (std::vector<Segment>::const_iterator i = mSegments.begin(); i != mSegments.end(); ++i) {
+		if (i->isBlob)
+			ioc << IOContainer::IOPair(const_cast<char*> (i->data), i->len);
+		else if (mHeaders[i->header].getSize() > 0)
+			ioc << IOContainer::IOPair(const_cast<char*> (mHeaders[i->header].getData()),
+					mHeaders[i->header].getSize());
+	}
+}
+
+size_t
+GatherPacket::getSize() const
+{
+	size_t size = 0;
+
+	for (std::vector<Segment>::const_iterator i = mSegments.begin(); i != mSegments.end(); ++i)
+		size += (i->isBlob) ? i->len : mHeaders[i->header].getSize();
+	return size;
+}
+
+std::string
+GatherPacket::dump() const
+{
+	std::string str;
+
+	str.reserve(getSize());
+	for (std::vector<Segment>::const_iterator i = mSegments.begin(); i != mSegments.end(); ++i) {
+		if (i->isBlob)
+			str.append(i->data, i->len);
+		else
+			str.append(mHeaders[i->header].getData(), mHeaders[i->header].getSize());
+	}
+	return str;
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,156 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaIdleWheel.cpp
+ * @brief Implements the idle timeout wheel of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include "NinaIdleWheel.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+//! @brief Convert a time in milliseconds
+static int64_t
+toMSec(Time const& time)
+{
+	return time.getNanoseconds() / Time::MSEC_IN_NSEC;
+}
+
+IdleWheel::IdleWheel(Time const& granularity, size_t slots)
+	: mSlots(slots < 2 ? 2 : slots),
+	mGranularity(granularity),
+	mBase(0, 0),
+	mCursor(0),
+	mGeneration(0)
+{
+	if (toMSec(mGranularity) <= 0)
+		mGranularity.set(0, Time::MSEC_IN_USEC);
+}
+
+IdleWheel::~IdleWheel()
+{
+}
+
+int
+IdleWheel::track(EventHandler* eHandler, Time const& timeout, Time const& now)
+{
+	Time	deadline(now);
+
+	if (eHandler == 0)
+		return -1;
+	// The wheel starts turning with its first EventHandler
+	if (mTracked.empty()) {
+		for (size_t i = 0; i < mSlots.size(); ++i)
+			mSlots[i].clear();
+		mBase = now;
+		mCursor = 0;
+	}
+	mTracked.erase(eHandler);
+	mTracked.insert(std::make_pair(eHandler, std::make_pair(timeout, mGeneration)));
+	eHandler->setLastActivity(now);
+	deadline += timeout;
+	insert(std::make_pair(eHandler, mGeneration++), deadline);
+	return 0;
+}
+
+int
+IdleWheel::untrack(EventHandler* eHandler)
+{
+	// Its entry becomes obsolete and is dropped when its slot is visited
+	return mTracked.erase(eHandler) == 1 ? 0 : -1;
+}
+
+int
+IdleWheel::setGranularity(Time const& granularity)
+{
+	if (mTracked.empty() == false || toMSec(granularity) <= 0)
+		return -1;
+	mGranularity = granularity;
+	return 0;
+}
+
+void
+IdleWheel::insert(Entry const& entry, Time const& deadline)
+{
+	int64_t	ticks;
+	int64_t	granularity = toMSec(mGranularity);
+
+	// The slot k is visited once mBase + k * mGranularity is reached
+	ticks = (toMSec(deadline) - toMSec(mBase) + granularity - 1) / granularity;
+	if (ticks < 1)
+		ticks = 1;
+	else if (ticks >= static_cast<int64_t> (mSlots.size()))
+		ticks = mSlots.size() - 1;
+	mSlots[(mCursor + static_cast<size_t> (ticks)) % mSlots.size()].push_back(entry);
+}
+
+size_t
+IdleWheel::expire(Time const& now)
+{
+	TrackTable::iterator	i;
+	Slot					slot;
+	Time					deadline(0, 0);
+	Time					next(mBase);
+	NINAHandle				handle;
+	EventHandler*			eHandler;
+	int						errCode;
+	size_t					count = 0;
+
+	next += mGranularity;
+	for (size_t n = 0; n < mSlots.size() && next <= now; ++n) {
+		mBase = next;
+		next += mGranularity;
+		mCursor = (mCursor + 1) % mSlots.size();
+		slot.swap(mSlots[mCursor]);
+		for (Slot::const_iterator j = slot.begin(); j != slot.end(); ++j) {
+			eHandler = j->first;
+			i = mTracked.find(eHandler);
+			if (i == mTracked.end() || i->second.second != j->second)
+				continue;
+			deadline = eHandler->getLastActivity();
+			deadline += i->second.first;
+			if (now < deadline) {
+				insert(*j, deadline);
+				continue;
+			}
+			++count;
+			handle = eHandler->getHandle();
+			errCode = eHandler->handleIdle(handle);
+			// The EventHandler may have been untracked or tracked again during the notification
+			i = mTracked.find(eHandler);
+			if (i != mTracked.end() && i->second.second == j->second) {
+				if (errCode == 0) {
+					eHandler->setLastActivity(now);
+					deadline = now;
+					deadline += i->second.first;
+					insert(*j, deadline);
+				}
+				else
+					mTracked.erase(i);
+			}
+			if (errCode == -1)
+				eHandler->handleClose(handle);
+		}
+		slot.clear();
+	}
+	// The wheel stalled for more than a revolution: every slot has been visited, thus it is realigned
+	if (next <= now)
+		mBase = now;
+	return count;
+}
+
+NINA_END_NAMESPACE_DECL
@@ -37,6 +37,7 @@
 
 #include "NinaSystemError.hpp"
 #include "NinaOS.hpp"
+#include "NinaNetTables.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
 
@@ -150,20 +151,18 @@ void
 InetAddr::remoteQuery(std::string const& host, std::string const& port,
 			std::string const& protocol, uint8_t mode)
 {
-	protoent*			pRes;
-	OS::NINAProtoBuf	pBuf;
+	int	protocolNum;
 
 	if (protocol.compare("any") == 0)
 		remoteQuery(host, port, ANY_PROTO, mode);
 	else {
-		if ((pRes = OS::getProtoByName(protocol.c_str(), &pBuf)) == 0)
+		if ((protocolNum = NetTables::getTables().getProtocolNumber(protocol.c_str())) < 0)
 #if defined (NINA_WIN32)
 			throw Error::SystemError(OS::setErrnoToWSALastError());
 #else
 			throw Error::SystemError("Could not record protocol");
 #endif // !NINA_WIN32
-		remoteQuery(host, port, pRes->p_proto, mode);
-		delete pRes;
+		remoteQuery(host, port, protocolNum, mode);
 	}
 }
 
@@ -230,20 +229,18 @@ void
 InetAddr::localQuery(std::string const& host, std::string const& port,
 			std::string const& protocol, uint8_t mode)
 {
-	protoent*			pRes;
-	OS::NINAProtoBuf	pBuf;
+	int	protocolNum;
 
 	if (protocol.compare("any") == 0)
 		localQuery(host, port, ANY_PROTO, mode);
 	else {
-		if ((pRes = OS::getProtoByName(protocol.c_str(), &pBuf)) == 0)
+		if ((protocolNum = NetTables::getTables().getProtocolNumber(protocol.c_str())) < 0)
 #if defined (NINA_WIN32)
 			throw Error::SystemError(OS::setErrnoToWSALastError());
 #else
 			throw Error::SystemError("Could not record protocol");
 #endif // !NINA_WIN32
-		localQuery(host, port, pRes->p_proto, mode);
-		delete pRes;
+		localQuery(host, port, protocolNum, mode);
 	}
 }
 
@@ -304,20 +301,18 @@ InetAddr::wildcardQuery(uint16_t port, int protocol)
 void
 InetAddr::wildcardQuery(std::string const& port, std::string const& protocol, uint8_t mode)
 {
-	protoent*			pRes;
-	OS::NINAProtoBuf	pBuf;
+	int	protocolNum;
 
 	if (protocol.compare("any") == 0)
 		wildcardQuery(port, ANY_PROTO, mode);
 	else {
-		if ((pRes = OS::getProtoByName(protocol.c_str(), &pBuf)) == 0)
+		if ((protocolNum = NetTables::getTables().getProtocolNumber(protocol.c_str())) < 0)
 #if defined (NINA_WIN32)
 			throw Error::SystemError(OS::setErrnoToWSALastError());
 #else
 			throw Error::SystemError("Could not record protocol");
 #endif // !NINA_WIN32
-		wildcardQuery(port, pRes->p_proto, mode);
-		delete pRes;
+		wildcardQuery(port, protocolNum, mode);
 	}	
 }
 
@@ -335,11 +330,9 @@ InetAddr::wildcardQuery(uint16_t port, std::string const& protocol)
 std::string
 InetAddr::getPortByName() const
 {
-	servent*			sRes;
 	uint16_t			portNum;
 	std::string			port;
 	std::string			protocol;
-	OS::NINAServBuf		sBuf;	
 
 	if ((portNum = getPortByNumber()) == 0)
 		throw Error::SystemError("Specified port is unknown");
@@ -349,14 +342,12 @@ InetAddr::getPortByName() const
 	catch (...) {
 		throw;
 	} 
-	if ((sRes = OS::getServByPort(htons(portNum), protocol.c_str(), &sBuf)) == 0)
+	if (NetTables::getTables().getServiceName(portNum, protocol.c_str(), port) < 0)
 #if defined (NINA_WIN32)
 		throw Error::SystemError(OS::setErrnoToWSALastError());
 #else
 		throw Error::SystemError("Could not find suitable service");
 #endif // !NINA_WIN32
-	port.assign(sRes->s_name);
-	delete sRes;
 	return port;
 } 
 
@@ -377,10 +368,8 @@ InetAddr::getPortByNumber() const
 void
 InetAddr::setPort(std::string const& port)
 {
-	servent*			sRes;
 	std::string			protocol;
-	OS::NINAServBuf     sBuf;
-	uint16_t			portNum;
+	int					portNum;
 
 	try {
 		protocol = getProtocolByName();
@@ -388,15 +377,13 @@ InetAddr::setPort(std::string const& port)
 	catch (...) {
 		throw;
 	}
-	if ((sRes = OS::getServByName(port.c_str(), protocol.c_str(), &sBuf)) == 0)
+	if ((portNum = NetTables::getTables().getServicePort(port.c_str(), protocol.c_str())) < 0)
 #if defined (NINA_WIN32)
 		throw Error::SystemError(OS::setErrnoToWSALastError());
 #else
 		throw Error::SystemError("Could not record service");
 #endif // !NINA_WIN32
-	portNum = ntohs(sRes->s_port);
-	delete sRes;
-	if (setPort(portNum) < 0)
+	if (setPort(static_cast<uint16_t> (portNum)) < 0)
 		throw Error::SystemError("Address family unknown");
 }
 
@@ -473,21 +460,17 @@ InetAddr::getHostAddr()
 std::string
 InetAddr::getProtocolByName() const
 {
-	protoent*			pRes;
 	int					protocolNum;
 	std::string			protocol;
-	OS::NINAProtoBuf	pBuf;
 
 	if ((protocolNum = getProtocolByNumber()) < 0)
 		throw Error::SystemError("Specified protocol is unknown");
-	if ((pRes = OS::getProtoByNumber(protocolNum, &pBuf)) == 0)
+	if (NetTables::getTables().getProtocolName(protocolNum, protocol) < 0)
 #if defined (NINA_WIN32)
 		throw Error::SystemError(OS::setErrnoToWSALastError());
 #else
 		throw Error::SystemError("Could not find suitable protocol");
 #endif // !NINA_WIN32
-	protocol.assign(pRes->p_name);
-	delete pRes;
 	return protocol;
 }
 
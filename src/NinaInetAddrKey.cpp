@@ -0,0 +1,76 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaInetAddrKey.cpp
+ * @brief Implements the hashable keys of the internet domain addresses
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <cstring>
+#include "NinaInetAddrKey.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+InetAddrKey::InetAddrKey(InetAddr const& addr)
+{
+	set(addr);
+}
+
+int
+InetAddrKey::set(void const* addr, size_t addrLen)
+{
+	sockaddr const*	sa = static_cast<sockaddr const*> (addr);
+	unsigned char	bytes[16];
+	uint16_t		family;
+	uint16_t		port;
+	uint32_t		scopeId = 0;
+
+	mWords[0] = 0;
+	mWords[1] = 0;
+	mWords[2] = 0;
+	if (addr == 0 || addrLen < sizeof(sa->sa_family))
+		return -1;
+	if (sa->sa_family == AF_INET && addrLen >= sizeof(sockaddr_in)) {
+		sockaddr_in const*	sin = static_cast<sockaddr_in const*> (addr);
+
+		// ::ffff:a.b.c.d
+		::memset(bytes, 0, 10);
+		bytes[10] = 0xFF;
+		bytes[11] = 0xFF;
+		::memcpy(bytes + 12, &sin->sin_addr, 4);
+		family = AF_INET;
+		port = ntohs(sin->sin_port);
+	}
+	else if (sa->sa_family == AF_INET6 && addrLen >= sizeof(sockaddr_in6)) {
+		sockaddr_in6 const*	sin6 = static_cast<sockaddr_in6 const*> (addr);
+
+		::memcpy(bytes, &sin6->sin6_addr, 16);
+		port = ntohs(sin6->sin6_port);
+		if (IN6_IS_ADDR_V4MAPPED(&sin6->sin6_addr))
+			family = AF_INET;
+		else {
+			family = AF_INET6;
+			scopeId = sin6->sin6_scope_id;
+		}
+	}
+	else
+		return -1;
+	::memcpy(mWords, bytes, sizeof bytes);
+	mWords[2] = (static_cast<uint64_t> (family) << 48) | (static_cast<uint64_t> (port) << 32) | scopeId;
+	return 0;
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,148 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaInetAddrList.cpp
+ * @brief Implements the multiple results of an internet domain address resolution
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include "NinaDef.hpp"
+#include "NinaInetAddrList.hpp"
+
+#if defined (NINA_POSIX)
+# include <sys/types.h>
+# include <sys/socket.h>
+# include <netdb.h>
+#endif // !NINA_POSIX
+#if defined (NINA_WIN32)
+# include <Windows.h>
+#endif // !NINA_WIN32
+
+#include "NinaSystemError.hpp"
+#include "NinaOS.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+InetAddrList::InetAddrList(int family)
+	: std::vector<InetAddr>(),
+	mFamily(family),
+	mForcedSockType(InetAddr::ANY_SOCK)
+{
+	if (family != AF_INET && family != AF_INET6 && family != AF_UNSPEC)
+		throw std::invalid_argument("Unknown family");
+}
+
+InetAddrList::~InetAddrList()
+{
+}
+
+InetAddrList::InetAddrList(InetAddrList const& list)
+	: std::vector<InetAddr>(list),
+	mFamily(list.mFamily),
+	mForcedSockType(list.mForcedSockType)
+{
+}
+
+InetAddrList&
+InetAddrList::operator=(InetAddrList const& list)
+{
+	if (this != &list) {
+		std::vector<InetAddr>::operator=(list);
+		mFamily = list.mFamily;
+		mForcedSockType = list.mForcedSockType;
+	}
+	return *this;
+}
+
+void
+InetAddrList::remoteQuery(std::string const& host, std::string const& port,
+			int protocol, uint8_t mode)
+{
+	int	r;
+
+	if ((r = resolve(host, port, protocol, mode)) != 0)
+#if defined (NINA_WIN32)
+		throw Error::SystemError(OS::setErrnoToWSALastError());
+#else
+		throw Error::SystemError(::gai_strerror(r));
+#endif // !NINA_WIN32
+}
+
+int
+InetAddrList::resolve(std::string const& host, std::string const& port,
+			int protocol, uint8_t mode)
+{
+	int						r;
+	addrinfo				hints;
+	addrinfo				*res;
+	InetAddr				addr;
+	std::vector<InetAddr>	preferred;
+	std::vector<InetAddr>	others;
+
+	clear();
+	::memset(&hints, 0, sizeof(hints));
+#if !defined (NINA_LACK_OF_V4MAPPED)
+	if ((mode & InetAddr::IPV4_MAPPED) != 0)
+		hints.ai_flags |= AI_V4MAPPED;
+#endif // !NINA_LACK_OF_V4MAPPED
+	if ((mode & InetAddr::NAME_RESOLUTION) == 0)
+		hints.ai_flags |= AI_NUMERICHOST;
+	if ((mode & InetAddr::SERV_RESOLUTION) == 0)
+		hints.ai_flags |= AI_NUMERICSERV;
+	hints.ai_family = mFamily;
+	hints.ai_protocol = protocol;
+	hints.ai_socktype = mForcedSockType;
+	if ((r = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &res)) != 0)
+		return r;
+	// The results are already sorted by preference (RFC 6724), split them by family keeping that order
+	for (addrinfo* ai = res; ai != 0; ai = ai->ai_next) {
+		if (addr.setAddr(ai->ai_addr, ai->ai_addrlen) < 0)
+			continue;
+		std::vector<InetAddr>& family = (ai->ai_family == res->ai_family ? preferred : others);
+		// Several socket types or protocols yield the same address
+		if (std::find(family.begin(), family.end(), addr) == family.end())
+			family.push_back(addr);
+	}
+	::freeaddrinfo(res);
+	mForcedSockType = InetAddr::ANY_SOCK;
+	// Interleave the families, starting with the preferred one
+	reserve(preferred.size() + others.size());
+	for (size_t i = 0; i < preferred.size() || i < others.size(); ++i) {
+		if (i < preferred.size())
+			push_back(preferred[i]);
+		if (i < others.size())
+			push_back(others[i]);
+	}
+	return 0;
+}
+
+void
+InetAddrList::remoteQuery(std::string const& host, uint16_t port,
+			int protocol, uint8_t mode)
+{
+	std::stringstream	ss;
+	std::string			cPort;
+
+	ss << port;
+	ss >> cPort;
+	mode &= ~InetAddr::SERV_RESOLUTION;
+	remoteQuery(host, cPort, protocol, mode);
+}
+
+NINA_END_NAMESPACE_DECL
@@ -118,8 +118,11 @@ KqueuePolicy::handleEvents(Time const* timeout)
 	DemuxTableElement const*	elem;
 	NINAHandle					skipHandle = NINA_INVALID_HANDLE;
 
-	timespec const*	time = (timeout == 0) ? 0 : timeout->getTimespec();
-	errCode = ::kevent(mFdQueue, 0, 0, mFdSet, mOpenMax, time);
+	timespec	time;
+
+	if (timeout != 0)
+		timeout->getTimespec(time);
+	errCode = ::kevent(mFdQueue, 0, 0, mFdSet, mOpenMax, (timeout == 0) ? 0 : &time);
 	if (errCode == NINA_ENDPOINT_ERROR && errno != EINTR)
 			return -1;
 	for (int n = 0; n < errCode; ++n) {
@@ -0,0 +1,117 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaLatencyHistogram.cpp
+ * @brief Implements the latency histogram of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <cstring>
+#include "NinaLatencyHistogram.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+LatencyHistogram::LatencyHistogram()
+{
+	reset();
+}
+
+LatencyHistogram::~LatencyHistogram()
+{
+}
+
+LatencyHistogram::LatencyHistogram(LatencyHistogram const& histogram)
+	: mCount(histogram.mCount),
+	mSum(histogram.mSum),
+	mMin(histogram.mMin),
+	mMax(histogram.mMax)
+{
+	::memcpy(mBuckets, histogram.mBuckets, sizeof mBuckets);
+}
+
+LatencyHistogram&
+LatencyHistogram::operator=(LatencyHistogram const& histogram)
+{
+	if (this != &histogram) {
+		::memcpy(mBuckets, histogram.mBuckets, sizeof mBuckets);
+		mCount = histogram.mCount;
+		mSum = histogram.mSum;
+		mMin = histogram.mMin;
+		mMax = histogram.mMax;
+	}
+	return *this;
+}
+
+void
+LatencyHistogram::merge(LatencyHistogram const& histogram)
+{
+	if (histogram.mCount == 0)
+		return;
+	for (size_t i = 0; i < BUCKETS; ++i)
+		mBuckets[i] += histogram.mBuckets[i];
+	if (mCount == 0 || histogram.mMin < mMin)
+		mMin = histogram.mMin;
+	if (mCount == 0 || histogram.mMax > mMax)
+		mMax = histogram.mMax;
+	mCount += histogram.mCount;
+	mSum += histogram.mSum;
+}
+
+void
+LatencyHistogram::reset()
+{
+	::memset(mBuckets, 0, sizeof mBuckets);
+	mCount = 0;
+	mSum = 0;
+	mMin = 0;
+	mMax = 0;
+}
+
+Time
+LatencyHistogram::getBucketBound(size_t idx)
+{
+	// The last bound does not fit in a Time, the highest one is used instead
+	if (idx >= BUCKETS - 1)
+		return Time::fromNanoseconds(~(static_cast<uint64_t> (1) << 63));
+	return Time::fromNanoseconds(static_cast<int64_t> (1) << idx);
+}
+
+Time
+LatencyHistogram::getPercentile(double ratio) const
+{
+	uint64_t	rank;
+	uint64_t	seen = 0;
+
+	if (mCount == 0)
+		return Time::timeNull;
+	if (ratio < 0)
+		ratio = 0;
+	rank = static_cast<uint64_t> (ratio * mCount);
+	if (rank >= mCount)
+		rank = mCount - 1;
+	for (size_t i = 0; i < BUCKETS; ++i) {
+		seen += mBuckets[i];
+		if (seen > rank) {
+			Time	bound = getBucketBound(i);
+
+			return (bound.getNanoseconds() < mMax ? bound : getMax());
+		}
+	}
+	return getMax();
+}
+
+NINA_END_NAMESPACE_DECL
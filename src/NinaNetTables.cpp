@@ -0,0 +1,226 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaNetTables.cpp
+ * @brief Implements the cached protocol and service tables of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "NinaDef.hpp"
+#include "NinaNetTables.hpp"
+
+#if defined (NINA_POSIX)
+# include <netdb.h>
+# include <arpa/inet.h>
+#endif // !NINA_POSIX
+#if defined (NINA_WIN32)
+# include <winsock2.h>
+#endif // !NINA_WIN32
+
+#include "NinaOS.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+NetTables const&
+NetTables::getTables()
+{
+	// Initialized once on first use (the compilers supported guard the initialization of local statics)
+	static NetTables const	tables;
+
+	return tables;
+}
+
+NetTables::NetTables()
+{
+#if defined (NINA_POSIX)
+	Entry		entry;
+	protoent*	pEntry;
+	servent*	sEntry;
+
+	// The enumeration functions are not reentrant but they only run once, from the initialization above
+	::setprotoent(1);
+	while ((pEntry = ::getprotoent()) != 0) {
+		entry.officialName = pEntry->p_name;
+		entry.number = pEntry->p_proto;
+		entry.name = entry.officialName;
+		mProtocolsByName.push_back(entry);
+		mProtocolsByNumber.push_back(entry);
+		for (char** alias = pEntry->p_aliases; alias != 0 && *alias != 0; ++alias) {
+			entry.name = *alias;
+			mProtocolsByName.push_back(entry);
+		}
+	}
+	::endprotoent();
+	::setservent(1);
+	while ((sEntry = ::getservent()) != 0) {
+		entry.officialName = sEntry->s_name;
+		entry.protocol = sEntry->s_proto;
+		entry.number = ntohs(static_cast<uint16_t> (sEntry->s_port));
+		entry.name = entry.officialName;
+		mServicesByName.push_back(entry);
+		mServicesByPort.push_back(entry);
+		for (char** alias = sEntry->s_aliases; alias != 0 && *alias != 0; ++alias) {
+			entry.name = *alias;
+			mServicesByName.push_back(entry);
+		}
+	}
+	::endservent();
+	// Stable sorts keep the order of the files, thus the first matching entry wins as with the operating system
+	std::stable_sort(mProtocolsByName.begin(), mProtocolsByName.end(), ByName());
+	std::stable_sort(mProtocolsByNumber.begin(), mProtocolsByNumber.end(), ByNumber());
+	std::stable_sort(mServicesByName.begin(), mServicesByName.end(), ByName());
+	std::stable_sort(mServicesByPort.begin(), mServicesByPort.end(), ByNumber());
+#endif // !NINA_POSIX
+}
+
+int
+NetTables::getProtocolNumber(char const* name) const
+{
+	Table::const_iterator	i;
+	protoent*				pRes;
+	OS::NINAProtoBuf		pBuf;
+	int						number;
+
+	if ((i = findName(mProtocolsByName, name, 0)) != mProtocolsByName.end())
+		return i->number;
+	if ((pRes = OS::getProtoByName(name, &pBuf)) == 0)
+		return -1;
+	number = pRes->p_proto;
+	delete pRes;
+	return number;
+}
+
+int
+NetTables::getProtocolName(int number, std::string& name) const
+{
+	Table::const_iterator	i;
+	protoent*				pRes;
+	OS::NINAProtoBuf		pBuf;
+
+	if ((i = findNumber(mProtocolsByNumber, number, 0)) != mProtocolsByNumber.end()) {
+		name = i->officialName;
+		return 0;
+	}
+	if ((pRes = OS::getProtoByNumber(number, &pBuf)) == 0)
+		return -1;
+	name = pRes->p_name;
+	delete pRes;
+	return 0;
+}
+
+int
+NetTables::getServicePort(char const* name, char const* protocol) const
+{
+	Table::const_iterator	i;
+	servent*				sRes;
+	OS::NINAServBuf			sBuf;
+	int						port;
+
+	if ((i = findName(mServicesByName, name, protocol)) != mServicesByName.end())
+		return i->number;
+	if ((sRes = OS::getServByName(name, protocol, &sBuf)) == 0)
+		return -1;
+	port = ntohs(static_cast<uint16_t> (sRes->s_port));
+	delete sRes;
+	return port;
+}
+
+int
+NetTables::getServiceName(uint16_t port, char const* protocol, std::string& name) const
+{
+	Table::const_iterator	i;
+	servent*				sRes;
+	OS::NINAServBuf			sBuf;
+
+	if ((i = findNumber(mServicesByPort, port, protocol)) != mServicesByPort.end()) {
+		name = i->officialName;
+		return 0;
+	}
+	if ((sRes = OS::getServByPort(htons(port), protocol, &sBuf)) == 0)
+		return -1;
+	name = sRes->s_name;
+	delete sRes;
+	return 0;
+}
+
+size_t
+NetTables::getProtocolCount() const
+{
+	return mProtocolsByName.size();
+}
+
+size_t
+NetTables::getServiceCount() const
+{
+	return mServicesByName.size();
+}
+
+bool
+NetTables::ByName::operator()(Entry const& lhs, Entry const& rhs) const
+{
+	return lhs.name < rhs.name;
+}
+
+bool
+NetTables::ByNumber::operator()(Entry const& lhs, Entry const& rhs) const
+{
+	return lhs.number < rhs.number;
+}
+
+NetTables::Table::const_iterator
+NetTables::findName(Table const& table, char const* name, char const* protocol)
+{
+	size_t	low = 0;
+	size_t	high = table.size();
+	size_t	middle;
+
+	// Lower bound of the name, compared in place so that nothing is allocated
+	while (low < high) {
+		middle = low + (high - low) / 2;
+		if (::strcmp(table[middle].name.c_str(), name) < 0)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	for (; low < table.size() && table[low].name.compare(name) == 0; ++low)
+		if (protocol == 0 || table[low].protocol.compare(protocol) == 0)
+			return table.begin() + low;
+	return table.end();
+}
+
+NetTables::Table::const_iterator
+NetTables::findNumber(Table const& table, int number, char const* protocol)
+{
+	size_t	low = 0;
+	size_t	high = table.size();
+	size_t	middle;
+
+	while (low < high) {
+		middle = low + (high - low) / 2;
+		if (table[middle].number < number)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	for (; low < table.size() && table[low].number == number; ++low)
+		if (protocol == 0 || table[low].protocol.compare(protocol) == 0)
+			return table.begin() + low;
+	return table.end();
+}
+
+NINA_END_NAMESPACE_DECL
@@ -21,6 +21,7 @@
 
 #include <stdexcept>
 #include <sstream>
+#include <cstdio>
 
 #include "NinaDef.hpp"
 
@@ -30,7 +31,13 @@
 # include <unistd.h>
 #endif // !NINA_POSIX
 
+#if defined (NINA_HAS_TIMESTAMPING)
+# include <linux/errqueue.h>
+#endif // !NINA_HAS_TIMESTAMPING
+
 #include "NinaIOContainer.hpp"
+#include "NinaDatagramBatch.hpp"
+#include "NinaSockIO.hpp"
 #include "NinaSystemError.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
@@ -231,24 +238,177 @@ gatherWrite(NINAHandle sock, IOContainer& ioc, unsigned long flags)
 	return errCode;
 }
 
+#if defined (NINA_HAS_TIMESTAMPING)
+//! @brief Read the software timestamp of the kernel from a control message (SO_TIMESTAMPING or SO_TIMESTAMPNS)
+static bool
+parseTimestamp(cmsghdr* cmsg, Time& stamp)
+{
+	timespec	ts;
+
+	if (cmsg->cmsg_level != SOL_SOCKET || (cmsg->cmsg_type != SCM_TIMESTAMPING && cmsg->cmsg_type != SCM_TIMESTAMPNS))
+		return false;
+	// The software timestamp comes first in a SCM_TIMESTAMPING message, followed by the hardware ones
+	::memcpy(&ts, CMSG_DATA(cmsg), sizeof ts);
+	if (ts.tv_sec == 0 && ts.tv_nsec == 0)
+		return false;
+	stamp.setNanoseconds(static_cast<int64_t> (ts.tv_sec) * Time::SEC_IN_NSEC + ts.tv_nsec);
+	return true;
+}
+#endif // !NINA_HAS_TIMESTAMPING
+
 int
-select(int fdLen, fd_set* readFds, fd_set* writeFds, fd_set* exceptFds, Time const* timeout)
+recvBatch(NINAHandle sock, DatagramBatch& batch, int flags)
 {
+	int		errCode;
+
+	batch.mCount = 0;
+#if defined (NINA_HAS_RECVMMSG)
+	for (size_t i = 0; i < batch.mHeaders.size(); ++i) {
+		batch.mHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+		batch.mHeaders[i].msg_hdr.msg_controllen = DatagramBatch::CONTROL_SIZE;
+	}
+	// Without MSG_WAITFORONE a blocking handle would wait until the whole batch is filled
+	errCode = ::recvmmsg(sock, &batch.mHeaders[0], batch.mHeaders.size(), flags | MSG_WAITFORONE, 0);
+	if (errCode <= 0)
+		return errCode;
+	for (int i = 0; i < errCode; ++i) {
+		msghdr*			hdr = &batch.mHeaders[i].msg_hdr;
+		sockaddr_storage*	dest = &batch.mDests[i];
+
+		batch.mSizes[i] = batch.mHeaders[i].msg_len;
+		batch.mAddrLens[i] = hdr->msg_namelen;
+		batch.mDestLens[i] = 0;
+		batch.mStamps[i] = Time::timeNull;
+		for (cmsghdr* cmsg = CMSG_FIRSTHDR(hdr); cmsg != 0; cmsg = CMSG_NXTHDR(hdr, cmsg)) {
+# if defined (NINA_HAS_TIMESTAMPING)
+			if (parseTimestamp(cmsg, batch.mStamps[i]))
+				continue;
+# endif // !NINA_HAS_TIMESTAMPING
+			if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO) {
+				sockaddr_in*	sa = reinterpret_cast<sockaddr_in*> (dest);
+
+				::memset(sa, 0, sizeof *sa);
+				sa->sin_family = AF_INET;
+				sa->sin_addr = reinterpret_cast<in_pktinfo const*> (CMSG_DATA(cmsg))->ipi_addr;
+				batch.mDestLens[i] = sizeof *sa;
+			}
+			else if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO) {
+				sockaddr_in6*	sa = reinterpret_cast<sockaddr_in6*> (dest);
+
+				::memset(sa, 0, sizeof *sa);
+				sa->sin6_family = AF_INET6;
+				sa->sin6_addr = reinterpret_cast<in6_pktinfo const*> (CMSG_DATA(cmsg))->ipi6_addr;
+				batch.mDestLens[i] = sizeof *sa;
+			}
+		}
+	}
+#else
+	batch.mAddrLens[0] = sizeof(sockaddr_storage);
+	errCode = recvFrom(sock, &batch.mBuffer[0], batch.mDatagramSize, flags,
+			reinterpret_cast<sockaddr*> (&batch.mAddrs[0]), &batch.mAddrLens[0]);
+	if (errCode < 0)
+		return errCode;
+	batch.mSizes[0] = errCode;
+	batch.mDestLens[0] = 0;
+	batch.mStamps[0] = Time::timeNull;
+	errCode = 1;
+#endif // !NINA_HAS_RECVMMSG
+	batch.mCount = errCode;
+	return errCode;
+}
+
+int
+recvTimestamped(NINAHandle sock, void* buf, size_t bufLen, int flags, Time* stamp)
+{
+	*stamp = Time::timeNull;
+#if defined (NINA_HAS_TIMESTAMPING)
+	// Room for the timestamps along with the packet info of a datagram socket
+	union {
+		cmsghdr	align;
+		char	data[CMSG_SPACE(sizeof(scm_timestamping)) + CMSG_SPACE(sizeof(in6_pktinfo))];
+	}			control;
+	msghdr		msg;
+	iovec		vec;
 	int			errCode;
-	Time*		nonConstTimeout = const_cast<Time*> (timeout);
-	Time		savedTime = Time::timeNull;
+
+	vec.iov_base = buf;
+	vec.iov_len = bufLen;
+	::memset(&msg, 0, sizeof msg);
+	msg.msg_iov = &vec;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.data;
+	msg.msg_controllen = sizeof control.data;
+	errCode = ::recvmsg(sock, &msg, flags);
+	if (errCode < 0)
+		return errCode;
+	for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != 0; cmsg = CMSG_NXTHDR(&msg, cmsg))
+		if (parseTimestamp(cmsg, *stamp))
+			break;
+	return errCode;
+#else
+	return recv(sock, buf, bufLen, flags);
+#endif // !NINA_HAS_TIMESTAMPING
+}
+
+int
+recvSendTimestamp(NINAHandle sock, SendTimestamp* stamp)
+{
+#if defined (NINA_HAS_TIMESTAMPING)
+	union {
+		cmsghdr	align;
+		char	data[CMSG_SPACE(sizeof(scm_timestamping)) + CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_storage))];
+	}			control;
+	msghdr		msg;
+	bool		hasStamp = false;
+	bool		hasInfo = false;
+
+	// The payload is not looped back with SOF_TIMESTAMPING_OPT_TSONLY, only the control messages matter
+	::memset(&msg, 0, sizeof msg);
+	msg.msg_control = control.data;
+	msg.msg_controllen = sizeof control.data;
+	if (::recvmsg(sock, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+		return NINA_ENDPOINT_ERROR;
+	for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != 0; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		sock_extended_err	err;
+
+		if (parseTimestamp(cmsg, stamp->stamp)) {
+			hasStamp = true;
+			continue;
+		}
+		if ((cmsg->cmsg_level != IPPROTO_IP || cmsg->cmsg_type != IP_RECVERR)
+				&& (cmsg->cmsg_level != IPPROTO_IPV6 || cmsg->cmsg_type != IPV6_RECVERR))
+			continue;
+		::memcpy(&err, CMSG_DATA(cmsg), sizeof err);
+		if (err.ee_errno != ENOMSG || err.ee_origin != SO_EE_ORIGIN_TIMESTAMPING)
+			continue;
+		if (err.ee_info == SCM_TSTAMP_SND)
+			stamp->type = SendTimestamp::SENT;
+		else if (err.ee_info == SCM_TSTAMP_ACK)
+			stamp->type = SendTimestamp::ACKNOWLEDGED;
+		else
+			continue;
+		stamp->id = err.ee_data;
+		hasInfo = true;
+	}
+	return (hasStamp && hasInfo ? 1 : 0);
+#else
+	NINA_UNUSED_ARG(sock);
+	NINA_UNUSED_ARG(stamp);
+	setLastError(ENOTSUP);
+	return NINA_ENDPOINT_ERROR;
+#endif // !NINA_HAS_TIMESTAMPING
+}
+
+int
+select(int fdLen, fd_set* readFds, fd_set* writeFds, fd_set* exceptFds, Time const* timeout)
+{
+	timeval		tv;
 
 	if (timeout == 0)
 		return ::select(fdLen, readFds, writeFds, exceptFds, 0);
-	savedTime = *timeout;
-#if defined (NINA_WIN32)
-	errCode = ::select(fdLen, readFds, writeFds, exceptFds, timeout->getTimeval());
-#else
-	timeval* tv = const_cast<timeval*> (timeout->getTimeval());
-	errCode = ::select(fdLen, readFds, writeFds, exceptFds, tv);
-#endif // !NINA_WIN32
-	*nonConstTimeout = savedTime;
-	return errCode;
+	// select may update the timeval, thus it works on a copy
+	timeout->getTimeval(tv);
+	return ::select(fdLen, readFds, writeFds, exceptFds, &tv);
 }
 
 int
@@ -272,9 +432,8 @@ poll(NINAPollData* fdSet, unsigned long fdSetLen, Time const* timeout)
 }
 
 int
-getCurrentTime(NINATimeval* tv)
+getCurrentTime(int64_t* nSec)
 {
-	int				errCode = 0;
 #if defined (NINA_WIN32)
 	ULARGE_INTEGER	ul;
 	FILETIME		ft;
@@ -282,21 +441,69 @@ getCurrentTime(NINATimeval* tv)
 	GetSystemTimeAsFileTime(&ft);
 	ul.LowPart = ft.dwLowDateTime;
 	ul.HighPart = ft.dwHighDateTime;
-	ul.QuadPart /= 10ULL; // to microseconds
-	ul.QuadPart -= 11644473600000000ULL; // UNIX Epoch delta
-	tv->tv_usec = static_cast<long> (ul.QuadPart % 1000000LL); // microseconds
-	tv->tv_sec = static_cast<time_t> (ul.QuadPart / 1000000LL); // seconds
+	ul.QuadPart -= 116444736000000000ULL; // UNIX Epoch delta in 100 nanoseconds
+	*nSec = static_cast<int64_t> (ul.QuadPart) * 100;
 #else
-	timespec			ts;
+	timespec	ts;
 
-	errCode = clock_gettime(CLOCK_REALTIME, &ts);
-	if (errCode == 0) {
-		tv->tv_usec = ts.tv_nsec / 1000;
-		tv->tv_sec = ts.tv_sec + tv->tv_usec / 1000000;
-		tv->tv_usec %= 1000000;
-	}
+	if (clock_gettime(CLOCK_REALTIME, &ts) < 0)
+		return -1;
+	*nSec = static_cast<int64_t> (ts.tv_sec) * Time::SEC_IN_NSEC + ts.tv_nsec;
 #endif // !NINA_WIN32
-	return errCode;
+	return 0;
+}
+
+int
+getMonotonicTime(int64_t* nSec, bool coarse)
+{
+#if defined (NINA_WIN32)
+	LARGE_INTEGER	counter;
+	LARGE_INTEGER	frequency;
+
+	NINA_UNUSED_ARG(coarse);
+	if (QueryPerformanceCounter(&counter) == 0 || QueryPerformanceFrequency(&frequency) == 0)
+		return -1;
+	*nSec = (counter.QuadPart / frequency.QuadPart) * Time::SEC_IN_NSEC +
+		(counter.QuadPart % frequency.QuadPart) * Time::SEC_IN_NSEC / frequency.QuadPart;
+#else
+	timespec	ts;
+	clockid_t	clock = CLOCK_MONOTONIC;
+
+# if defined (CLOCK_MONOTONIC_COARSE)
+	if (coarse == true)
+		clock = CLOCK_MONOTONIC_COARSE;
+# else
+	NINA_UNUSED_ARG(coarse);
+# endif // !CLOCK_MONOTONIC_COARSE
+	if (clock_gettime(clock, &ts) < 0)
+		return -1;
+	*nSec = static_cast<int64_t> (ts.tv_sec) * Time::SEC_IN_NSEC + ts.tv_nsec;
+#endif // !NINA_WIN32
+	return 0;
+}
+
+long
+getResidentSize()
+{
+#if defined (NINA_LINUX)
+	FILE*	statm;
+	long	size;
+	long	resident;
+	int		count;
+
+	if ((statm = std::fopen("/proc/self/statm", "r")) == 0)
+		return -1;
+	count = std::fscanf(statm, "%ld %ld", &size, &resident);
+	std::fclose(statm);
+	if (count != 2) {
+		errno = EIO;
+		return -1;
+	}
+	return resident * ::sysconf(_SC_PAGESIZE);
+#else
+	errno = ENOTSUP;
+	return -1;
+#endif // !NINA_LINUX
 }
 
  NINA_END_NAMESPACE_OS
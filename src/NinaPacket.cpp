@@ -20,15 +20,24 @@
  */
 
 #include "NinaPacket.hpp"
+#include "NinaCRC32C.hpp"
+
+#include <cstring>
 
 NINA_BEGIN_NAMESPACE_DECL
 
-OutputPacket::OutputPacket(std::string const& str)
+OutputPacket::OutputPacket(std::string const& str, CDR::Encoding encoding)
+	: mEncoding(encoding),
+	mByteOrder(CDR::NETWORK_ORDER),
+	mSwap(CDR::NETWORK_ORDER != CDR::HOST_ORDER)
 {
 	mStream.str(str);
 }
 
 OutputPacket::OutputPacket(OutputPacket const& opack)
+	: mEncoding(opack.mEncoding),
+	mByteOrder(opack.mByteOrder),
+	mSwap(opack.mSwap)
 {
 	mStream.str(opack.mStream.str());
 }
@@ -38,16 +47,65 @@ OutputPacket::operator=(OutputPacket const& opack)
 {
 	if (this != &opack) {
 		mStream.str(opack.mStream.str());
+		mEncoding = opack.mEncoding;
+		mByteOrder = opack.mByteOrder;
+		mSwap = opack.mSwap;
 	}
 	return *this;
 }
 
-InputPacket::InputPacket(std::string const& str)
+OutputPacket&
+OutputPacket::putVarint(uint64_t value)
+{
+	char	buf[CDR::MAX_VARINT_SIZE];
+	size_t	len = 0;
+
+	while (value >= 0x80) {
+		buf[len++] = static_cast<char> (value | 0x80);
+		value >>= 7;
+	}
+	buf[len++] = static_cast<char> (value);
+	mStream.sputn(buf, len);
+	return *this;
+}
+
+OutputPacket&
+OutputPacket::writeFormat()
+{
+	CDR::UChar format = 0;
+
+	if (mByteOrder == CDR::LITTLE_ENDIAN_ORDER)
+		format |= CDR::FORMAT_LITTLE_ENDIAN;
+	if (mEncoding == CDR::COMPACT)
+		format |= CDR::FORMAT_COMPACT;
+	mStream.sputc(static_cast<char> (format));
+	return *this;
+}
+
+OutputPacket&
+OutputPacket::writeChecksum()
+{
+	char trailer[CRC32C::SIZE];
+
+	CRC32C::store(CRC32C::compute(mStream.getData(), mStream.getSize()), trailer);
+	mStream.sputn(trailer, sizeof(trailer));
+	return *this;
+}
+
+InputPacket::InputPacket(std::string const& str, CDR::Encoding encoding)
+	: mEncoding(encoding),
+	mByteOrder(CDR::NETWORK_ORDER),
+	mSwap(CDR::NETWORK_ORDER != CDR::HOST_ORDER),
+	mIsTruncated(false)
 {
 	mStream.str(str);
 }
 
 InputPacket::InputPacket(InputPacket const& ipack)
+	: mEncoding(ipack.mEncoding),
+	mByteOrder(ipack.mByteOrder),
+	mSwap(ipack.mSwap),
+	mIsTruncated(false)
 {
 	mStream.str(ipack.mStream.str());
 }
@@ -57,6 +115,10 @@ InputPacket::operator=(InputPacket const& ipack)
 {
 	if (this != &ipack) {
 		mStream.str(ipack.mStream.str());
+		mEncoding = ipack.mEncoding;
+		mByteOrder = ipack.mByteOrder;
+		mSwap = ipack.mSwap;
+		mIsTruncated = false;
 	}
 	return *this;
 }
@@ -64,78 +126,69 @@ InputPacket::operator=(InputPacket const& ipack)
 InputPacket&
 InputPacket::operator>>(CDR::String& str)
 {
-	char	c;
+	int	c;
 
 	str.erase();
 	while ((c = mStream.sbumpc()) != '\0' && c != EOF)
-		str.push_back(c);
+		str.push_back(static_cast<char> (c));
+	// A string always ends with a null character
+	if (c == EOF)
+		mIsTruncated = true;
 	return *this;
 }
 
 void
 InputPacket::peek(CDR::Short& value) const
 {
-	CDR::Short		hostValue;
-	std::streamsize	sz;
-
-	sz = mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	mStream.pubseekoff(-sz, std::ios_base::cur, std::ios_base::in);
-	value = ntohs(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::Short> (CDR::zigzagDecode(peekVarint()));
+	else
+		value = static_cast<CDR::Short> (peekFixed<uint16_t>());
 }
 
 void
 InputPacket::peek(CDR::UShort& value) const
 {
-	CDR::UShort		hostValue;
-	std::streamsize	sz;
-
-	sz = mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	mStream.pubseekoff(-sz, std::ios_base::cur, std::ios_base::in);
-	value = ntohs(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::UShort> (peekVarint());
+	else
+		value = static_cast<CDR::UShort> (peekFixed<uint16_t>());
 }
 
 void
 InputPacket::peek(CDR::Integer& value) const
 {
-	CDR::Integer	hostValue;
-	std::streamsize	sz;
-
-	sz = mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	mStream.pubseekoff(-sz, std::ios_base::cur, std::ios_base::in);
-	value = ntohl(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::Integer> (CDR::zigzagDecode(peekVarint()));
+	else
+		value = static_cast<CDR::Integer> (peekFixed<uint32_t>());
 }
 
 void
 InputPacket::peek(CDR::UInteger& value) const
 {
-	CDR::UInteger	hostValue;
-	std::streamsize	sz;
-
-	sz = mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	mStream.pubseekoff(-sz, std::ios_base::cur, std::ios_base::in);
-	value = ntohl(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::UInteger> (peekVarint());
+	else
+		value = static_cast<CDR::UInteger> (peekFixed<uint32_t>());
 }
 
 void
 InputPacket::peek(CDR::Long& value) const
 {
-	CDR::Long		hostValue;
-	std::streamsize	sz;
-
-	sz = mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	mStream.pubseekoff(-sz, std::ios_base::cur, std::ios_base::in);
-	value = ntohll(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::Long> (CDR::zigzagDecode(peekVarint()));
+	else
+		value = static_cast<CDR::Long> (peekFixed<uint64_t>());
 }
 
 void
 InputPacket::peek(CDR::ULong& value) const
 {
-	CDR::ULong		hostValue;
-	std::streamsize	sz;
-
-	sz = mStream.sgetn(reinterpret_cast<char*> (&hostValue), sizeof(hostValue));
-	mStream.pubseekoff(-sz, std::ios_base::cur, std::ios_base::in);
-	value = ntohll(hostValue);
+	if (mEncoding == CDR::COMPACT)
+		value = static_cast<CDR::ULong> (peekVarint());
+	else
+		value = static_cast<CDR::ULong> (peekFixed<uint64_t>());
 }
 
 
@@ -156,13 +209,84 @@ InputPacket::peek(CDR::String& str) const
 void
 InputPacket::get(CDR::String& str, size_t len)
 {
-	char			c;
+	int	c;
 
 	str.erase();
-	while ((c = mStream.sbumpc()) != EOF && len > 0) {
-		str.push_back(c);
+	while (len > 0 && (c = mStream.sbumpc()) != EOF) {
+		str.push_back(static_cast<char> (c));
 		len--;
 	}
+	if (len > 0)
+		mIsTruncated = true;
+}
+
+int
+InputPacket::readFormat()
+{
+	int format;
+
+	if ((format = mStream.sbumpc()) == EOF)
+		return -1;
+	setByteOrder((format & CDR::FORMAT_LITTLE_ENDIAN) ? CDR::LITTLE_ENDIAN_ORDER : CDR::BIG_ENDIAN_ORDER);
+	setEncoding((format & CDR::FORMAT_COMPACT) ? CDR::COMPACT : CDR::FIXED_WIDTH);
+	return 0;
+}
+
+uint64_t
+InputPacket::getVarint() const
+{
+	uint64_t	value = 0;
+	int			c;
+
+#if BYTE_ORDER == LITTLE_ENDIAN
+	if (mStream.getReadAvail() >= sizeof(uint64_t)) {
+		uint64_t	word;
+		uint64_t	stops;
+
+		std::memcpy(&word, mStream.getReadPtr(), sizeof(word));
+		stops = ~word & NINA_UINT64_C(0x80808080, 0x80808080);
+		if (stops != 0) {
+			// Keep the bytes up to the first one without continuation bit then pack the 7-bit groups
+			word &= (stops ^ (stops - 1)) & NINA_UINT64_C(0x7F7F7F7F, 0x7F7F7F7F);
+			word = (word & NINA_UINT64_C(0x007F007F, 0x007F007F)) | ((word & NINA_UINT64_C(0x7F007F00, 0x7F007F00)) >> 1);
+			word = (word & NINA_UINT64_C(0x00003FFF, 0x00003FFF)) | ((word & NINA_UINT64_C(0x3FFF0000, 0x3FFF0000)) >> 2);
+			word = (word & NINA_UINT64_C(0x00000000, 0x0FFFFFFF)) | ((word & NINA_UINT64_C(0x0FFFFFFF, 0x00000000)) >> 4);
+# if defined (__GNUC__)
+			mStream.consume(__builtin_ctzll(stops) / 8 + 1);
+# else
+			size_t len = 1;
+			while ((stops & 0x80) == 0) {
+				stops >>= 8;
+				len++;
+			}
+			mStream.consume(len);
+# endif // !__GNUC__
+			return word;
+		}
+	}
+#endif // !BYTE_ORDER == LITTLE_ENDIAN
+	for (unsigned int shift = 0; shift < 64; shift += 7) {
+		if ((c = mStream.sbumpc()) == EOF)
+			break;
+		value |= static_cast<uint64_t> (c & 0x7F) << shift;
+		if ((c & 0x80) == 0)
+			return value;
+	}
+	// The packet ended or the varint is longer than 64 bits
+	mIsTruncated = true;
+	return value;
+}
+
+uint64_t
+InputPacket::peekVarint() const
+{
+	std::streampos	pos;
+	uint64_t		value;
+
+	pos = mStream.pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+	value = getVarint();
+	mStream.pubseekpos(pos, std::ios_base::in);
+	return value;
 }
 
 NINA_END_NAMESPACE_DECL
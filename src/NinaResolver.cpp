@@ -0,0 +1,275 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaResolver.cpp
+ * @brief Implements the asynchronous name resolution of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <cerrno>
+#include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "NinaResolver.hpp"
+#include "NinaSystemError.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+Resolver::Resolver(size_t workers, size_t cacheSize)
+	: EventHandler(),
+	NonCopyable(),
+	mIsStopped(false),
+	mDispatching(0),
+	mCacheSize(cacheSize),
+	mTTL(DEFAULT_TTL, 0),
+	mNegativeTTL(DEFAULT_NEGATIVE_TTL, 0),
+	mLookups(0),
+	mHits(0)
+{
+	pthread_t	thread;
+	int			errCode;
+
+	if (::pipe(mPipe) < 0)
+		throw Error::SystemError(errno);
+	for (int i = 0; i < 2; ++i)
+		if (::fcntl(mPipe[i], F_SETFL, ::fcntl(mPipe[i], F_GETFL, 0) | O_NONBLOCK) < 0 ||
+				::fcntl(mPipe[i], F_SETFD, FD_CLOEXEC) < 0) {
+			errCode = errno;
+			::close(mPipe[0]);
+			::close(mPipe[1]);
+			throw Error::SystemError(errCode);
+		}
+	::pthread_mutex_init(&mLock, 0);
+	::pthread_cond_init(&mCond, 0);
+	for (size_t i = 0; i < (workers == 0 ? 1 : workers); ++i) {
+		if ((errCode = ::pthread_create(&thread, 0, &Resolver::run, this)) != 0) {
+			stop();
+			throw Error::SystemError(errCode);
+		}
+		mWorkers.push_back(thread);
+	}
+}
+
+Resolver::~Resolver()
+{
+	stop();
+}
+
+int
+Resolver::handleRead(NINAHandle)
+{
+	std::deque<Result>		results;
+	std::vector<Waiter>		waiters;
+	WaitTable::iterator		w;
+	char					buf[64];
+	Time					now(0, 0);
+
+	while (::read(mPipe[0], buf, sizeof buf) > 0)
+		;
+	::pthread_mutex_lock(&mLock);
+	results.swap(mResults);
+	::pthread_mutex_unlock(&mLock);
+	now.monotonic();
+	for (size_t i = 0; i < results.size(); ++i) {
+		storeCache(results[i], now);
+		w = mWaiting.find(results[i].query);
+		if (w == mWaiting.end())
+			continue;
+		// The handlers may resolve or cancel while being called
+		waiters.swap(w->second);
+		mWaiting.erase(w);
+		mDispatching = &waiters;
+		for (size_t j = 0; j < waiters.size(); ++j)
+			if (waiters[j].handler != 0)
+				deliver(results[i].query, results[i].addrs, results[i].error, waiters[j]);
+		mDispatching = 0;
+		waiters.clear();
+	}
+	return 0;
+}
+
+int
+Resolver::resolve(std::string const& host, uint16_t port, ResolveHandler* handler, int family, int protocol)
+{
+	Query				query;
+	Waiter				waiter;
+	Cache::iterator		c;
+	WaitTable::iterator	w;
+	Time				now(0, 0);
+
+	if (handler == 0 || (family != AF_INET && family != AF_INET6 && family != AF_UNSPEC)) {
+		errno = EINVAL;
+		return -1;
+	}
+	query.host = host;
+	query.family = family;
+	query.protocol = protocol;
+	waiter.handler = handler;
+	waiter.port = port;
+	// Numeric addresses do not need any lookup
+	{
+		InetAddrList	addrs(family);
+
+		if (addrs.resolve(host, "0", protocol, 0) == 0) {
+			deliver(query, addrs, 0, waiter);
+			return 1;
+		}
+	}
+	now.monotonic();
+	if ((c = findCache(query, now)) != mCache.end()) {
+		++mHits;
+		deliver(query, c->second.addrs, c->second.error, waiter);
+		return 1;
+	}
+	w = mWaiting.find(query);
+	if (w != mWaiting.end()) {
+		w->second.push_back(waiter);
+		return 0;
+	}
+	mWaiting[query].push_back(waiter);
+	::pthread_mutex_lock(&mLock);
+	mJobs.push_back(query);
+	::pthread_cond_signal(&mCond);
+	::pthread_mutex_unlock(&mLock);
+	++mLookups;
+	return 0;
+}
+
+void
+Resolver::cancel(ResolveHandler* handler)
+{
+	for (WaitTable::iterator w = mWaiting.begin(); w != mWaiting.end(); ++w)
+		for (size_t i = 0; i < w->second.size(); ++i)
+			if (w->second[i].handler == handler)
+				w->second[i].handler = 0;
+	if (mDispatching != 0)
+		for (size_t i = 0; i < mDispatching->size(); ++i)
+			if ((*mDispatching)[i].handler == handler)
+				(*mDispatching)[i].handler = 0;
+}
+
+int
+Resolver::lookup(std::string const& host, int protocol, InetAddrList& addrs)
+{
+	return addrs.resolve(host, "0", protocol, InetAddr::NAME_RESOLUTION);
+}
+
+void*
+Resolver::run(void* resolver)
+{
+	static_cast<Resolver*> (resolver)->work();
+	return 0;
+}
+
+void
+Resolver::work()
+{
+	Result	result;
+	char	c = 0;
+
+	::pthread_mutex_lock(&mLock);
+	for (;;) {
+		while (mIsStopped == false && mJobs.empty() == true)
+			::pthread_cond_wait(&mCond, &mLock);
+		if (mIsStopped == true)
+			break;
+		result.query = mJobs.front();
+		mJobs.pop_front();
+		::pthread_mutex_unlock(&mLock);
+
+		result.addrs = InetAddrList(result.query.family);
+		result.error = lookup(result.query.host, result.query.protocol, result.addrs);
+
+		::pthread_mutex_lock(&mLock);
+		mResults.push_back(result);
+		// A single notification is pending until the reactor takes the results
+		if (mResults.size() == 1)
+			while (::write(mPipe[1], &c, 1) < 0 && errno == EINTR)
+				;
+	}
+	::pthread_mutex_unlock(&mLock);
+}
+
+void
+Resolver::stop()
+{
+	::pthread_mutex_lock(&mLock);
+	mIsStopped = true;
+	::pthread_cond_broadcast(&mCond);
+	::pthread_mutex_unlock(&mLock);
+	for (size_t i = 0; i < mWorkers.size(); ++i)
+		::pthread_join(mWorkers[i], 0);
+	mWorkers.clear();
+	::pthread_cond_destroy(&mCond);
+	::pthread_mutex_destroy(&mLock);
+	::close(mPipe[0]);
+	::close(mPipe[1]);
+}
+
+Resolver::Cache::iterator
+Resolver::findCache(Query const& query, Time const& now)
+{
+	Cache::iterator	c;
+
+	c = mCache.find(query);
+	if (c == mCache.end())
+		return c;
+	if (c->second.expiry <= now) {
+		mLRU.erase(c->second.lru);
+		mCache.erase(c);
+		return mCache.end();
+	}
+	mLRU.splice(mLRU.begin(), mLRU, c->second.lru);
+	return c;
+}
+
+void
+Resolver::storeCache(Result const& result, Time const& now)
+{
+	Cache::iterator	c;
+
+	// Transient failures are retried on the next lookup
+	if (mCacheSize == 0 || (result.error != 0 && result.error != EAI_NONAME))
+		return;
+	c = mCache.find(result.query);
+	if (c == mCache.end()) {
+		if (mCache.size() >= mCacheSize) {
+			mCache.erase(mLRU.back());
+			mLRU.pop_back();
+		}
+		c = mCache.insert(std::make_pair(result.query, CacheEntry())).first;
+		mLRU.push_front(result.query);
+	}
+	else
+		mLRU.splice(mLRU.begin(), mLRU, c->second.lru);
+	c->second.lru = mLRU.begin();
+	c->second.addrs = result.addrs;
+	c->second.error = result.error;
+	c->second.expiry = now;
+	c->second.expiry += (result.error == 0 ? mTTL : mNegativeTTL);
+}
+
+void
+Resolver::deliver(Query const& query, InetAddrList const& addrs, int error, Waiter const& waiter) const
+{
+	InetAddrList	ported(addrs);
+
+	for (size_t i = 0; i < ported.size(); ++i)
+		ported[i].setPort(waiter.port);
+	waiter.handler->handleResolve(query.host, ported, error);
+}
+
+NINA_END_NAMESPACE_DECL
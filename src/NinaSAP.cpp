@@ -86,7 +86,7 @@ SAP::enable(uint8_t opt)
 		if (mClFlag < 0 && (mClFlag = ::fcntl(mTransportEndpoint, F_GETFD, 0)) < 0)
 			return -1;
 		mClFlag |= FD_CLOEXEC;
-		if (::fcntl(mTransportEndpoint, F_SETFD, mIOFlags) < 0)
+		if (::fcntl(mTransportEndpoint, F_SETFD, mClFlag) < 0)
 			return -1;
 	 }
 	if ((opt & OWNERSHIP) && ::fcntl(mTransportEndpoint, F_SETOWN, ::getpid()) < 0)
@@ -122,7 +122,7 @@ SAP::disable(uint8_t opt)
 		if (mClFlag < 0 && (mClFlag = ::fcntl(mTransportEndpoint, F_GETFD, 0)) < 0)
 			return -1;
 		mClFlag &= ~FD_CLOEXEC;
-		if (::fcntl(mTransportEndpoint, F_SETFD, mIOFlags) < 0)
+		if (::fcntl(mTransportEndpoint, F_SETFD, mClFlag) < 0)
 			return -1;
 	}
 	if ((opt & OWNERSHIP) && ::fcntl(mTransportEndpoint, F_SETOWN, 0) < 0)
@@ -30,6 +30,7 @@
 
 #include "NinaSock.hpp"
 #include "NinaOS.hpp"
+#include "NinaNetTables.hpp"
 #include "NinaSystemError.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
@@ -59,7 +60,7 @@ Sock::operator=(Sock const& sap)
 
 int
 Sock::open(Addr const& addr, int family, int protocol,
-	   	int sockType, bool reuseAddr)
+	   	int sockType, bool reuseAddr, bool reusePort)
 { 
 	int on = 1;
 
@@ -73,6 +74,18 @@ Sock::open(Addr const& addr, int family, int protocol,
 		close();
 		return -1;
 	}
+	if (reusePort == true) {
+#if defined (NINA_HAS_REUSEPORT)
+		if (setOption(SOL_SOCKET, SO_REUSEPORT, &on, sizeof on) < 0) {
+			close();
+			return -1;
+		}
+#else
+		close();
+		errno = NINA_BAD_ARG;
+		return -1;
+#endif // !NINA_HAS_REUSEPORT
+	}
 	if (addr != Addr::sapAny && ::bind(mTransportEndpoint,
 			   	static_cast<sockaddr const*> (addr.getAddr()),
 			   	addr.getSize()) == NINA_ENDPOINT_ERROR) {
@@ -85,23 +98,21 @@ Sock::open(Addr const& addr, int family, int protocol,
 
 void
 Sock::open(Addr const& addr, int family, std::string const& protocol,
-		int sockType, bool reuseAddr)
+		int sockType, bool reuseAddr, bool reusePort)
 {
-	protoent*			pRes;
-	OS::NINAProtoBuf	pBuf;
-	int					errCode;
+	int	protocolNum;
+	int	errCode;
 
 	if (protocol.compare("any") == 0)
-		errCode = open(addr, family, ANY_PROTO, sockType, reuseAddr);
+		errCode = open(addr, family, ANY_PROTO, sockType, reuseAddr, reusePort);
 	else {
-		if ((pRes = OS::getProtoByName(protocol.c_str(), &pBuf)) == 0)
+		if ((protocolNum = NetTables::getTables().getProtocolNumber(protocol.c_str())) < 0)
 #if defined (NINA_WIN32)
 			throw Error::SystemError(OS::setErrnoToWSALastError());
 #else
 			throw Error::SystemError("Could not record protocol");
 #endif // !NINA_WIN32
-		errCode = open(addr, family, pRes->p_proto, sockType, reuseAddr);
-		delete pRes;
+		errCode = open(addr, family, protocolNum, sockType, reuseAddr, reusePort);
 	}
 	if (errCode < 0)
 		throw Error::SystemError(errno);
@@ -155,8 +166,8 @@ Sock::getLocalAddr(Addr& sap) const
 		return -1;
 	} 
 	// It is safe here, to not consider errors
-	// /!\ However AF_UNIX is currently not supported and could leads to failures
-	sap.setAddr(&addr, addrLen);
+	if (sap.setAddr(&addr, addrLen) == 0)
+		return 0;
 	family = retrieveFamily(&addr);
 	sap.setFamily(family);
 	sap.setSize(addrLen);
@@ -178,8 +189,8 @@ Sock::getRemoteAddr(Addr& sap) const
 		return -1;
 	}
 	// It is safe here, to not consider errors
-	// /!\ However AF_UNIX is currently not supported and could leads to failures
-	sap.setAddr(&addr, addrLen);
+	if (sap.setAddr(&addr, addrLen) == 0)
+		return 0;
 	family = retrieveFamily(&addr);
 	sap.setFamily(family);
 	sap.setSize(addrLen);
@@ -190,6 +201,10 @@ int
 Sock::retrieveFamily(sockaddr_storage const* addr) const
 {
 	sockaddr const* sa = reinterpret_cast<sockaddr const*> (addr);
+#if defined (NINA_POSIX)
+	if (sa->sa_family == AF_UNIX)
+		return AF_UNIX;
+#endif // !NINA_POSIX
 	if (sa->sa_family != AF_INET && sa->sa_family != AF_INET6)
 		return -1;
 	return sa->sa_family;
@@ -22,6 +22,10 @@
 #include "NinaSockAcceptor.hpp"
 #include "NinaSystemError.hpp"
 
+#if defined (NINA_LINUX)
+# include <linux/filter.h>
+#endif // !NINA_LINUX
+
 NINA_BEGIN_NAMESPACE_DECL
 
 SockAcceptor::SockAcceptor()
@@ -47,12 +51,17 @@ SockAcceptor::operator=(SockAcceptor const& sap)
 }
 
 int
-SockAcceptor::open(Addr const& addr, int family, int protocol, bool reuseAddr, int backlog)
+SockAcceptor::open(Addr const& addr, int family, int protocol, bool reuseAddr, int backlog, bool reusePort,
+		SocketProfile const* profile)
 {
 	if (family == PF_UNSPEC)
 		family = addr.getFamily();
-	if (Sock::open(addr, family, protocol, SOCK_STREAM, reuseAddr) < 0)
+	if (Sock::open(addr, family, protocol, SOCK_STREAM, reuseAddr, reusePort) < 0)
+		return -1;
+	if (profile != 0 && profile->applyListener(*this) < 0) {
+		close();
 		return -1;
+	}
 	if (::listen(mTransportEndpoint, backlog) == NINA_ENDPOINT_ERROR) {
 		OS::setErrnoToWSALastError();
 		close();
@@ -62,16 +71,21 @@ SockAcceptor::open(Addr const& addr, int family, int protocol, bool reuseAddr, i
 }
 
 void
-SockAcceptor::open(Addr const& addr, int family, std::string const& protocol, bool reuseAddr, int backlog)
+SockAcceptor::open(Addr const& addr, int family, std::string const& protocol, bool reuseAddr, int backlog, bool reusePort,
+		SocketProfile const* profile)
 {
 	if (family == PF_UNSPEC)
 		family = addr.getFamily();
 	try {
-		Sock::open(addr, family, protocol, SOCK_STREAM, reuseAddr);
+		Sock::open(addr, family, protocol, SOCK_STREAM, reuseAddr, reusePort);
 	}
 	catch (...) {
 		throw;
 	}
+	if (profile != 0 && profile->applyListener(*this) < 0) {
+		close();
+		throw Error::SystemError(errno);
+	}
 	if (::listen(mTransportEndpoint, backlog) == NINA_ENDPOINT_ERROR) {
 		close();
 		throw Error::SystemError(OS::setErrnoToWSALastError());
@@ -79,16 +93,25 @@ SockAcceptor::open(Addr const& addr, int family, std::string const& protocol, bo
 }
 
 int
-SockAcceptor::accept(SockStream& sock, Addr* peerAddr)
+SockAcceptor::accept(SockStream& sock, Addr* peerAddr, uint8_t flags)
 {
 	int					s;
 	sockaddr_storage	addr;
 	int					size = sizeof addr;
+	sockaddr*			addrPtr = (peerAddr != 0 ? reinterpret_cast<sockaddr*> (&addr) : 0);
+	int*				sizePtr = (peerAddr != 0 ? &size : 0);
 
-	if (peerAddr != 0)
-		s = OS::accept(mTransportEndpoint, reinterpret_cast<sockaddr*> (&addr), &size);
-	else
-		s = OS::accept(mTransportEndpoint, 0, 0);
+#if defined (NINA_HAS_ACCEPT4)
+	int					sockFlags = 0;
+
+	if (flags & NON_BLOCK)
+		sockFlags |= SOCK_NONBLOCK;
+	if (flags & CLOSE_ON_EXEC)
+		sockFlags |= SOCK_CLOEXEC;
+	s = OS::accept(mTransportEndpoint, addrPtr, sizePtr, sockFlags);
+#else
+	s = OS::accept(mTransportEndpoint, addrPtr, sizePtr);
+#endif // !NINA_HAS_ACCEPT4
 	if (s == NINA_INVALID_HANDLE) {
 		OS::setErrnoToWSALastError();
 		return -1;
@@ -97,8 +120,72 @@ SockAcceptor::accept(SockStream& sock, Addr* peerAddr)
 	if (peerAddr != 0)
 		peerAddr->setAddr(&addr, size);
 	sock.setHandle(s);
-	sock.disable(NON_BLOCK);
+#if !defined (NINA_HAS_ACCEPT4)
+	// Some systems propagate the listener options to the accepted handle
+	if (flags & NON_BLOCK)
+		sock.enable(NON_BLOCK);
+	else
+		sock.disable(NON_BLOCK);
+	if (flags & CLOSE_ON_EXEC)
+		sock.enable(CLOSE_ON_EXEC);
+#endif // !NINA_HAS_ACCEPT4
 	return 0;
 }
 
+int
+SockAcceptor::adopt(NINAHandle handle)
+{
+	int	listening = 0;
+	int	len = sizeof listening;
+
+	if (handle == NINA_INVALID_HANDLE) {
+		errno = NINA_BAD_ARG;
+		return -1;
+	}
+	close();
+	setHandle(handle);
+#if defined (SO_ACCEPTCONN)
+	if (getOption(SOL_SOCKET, SO_ACCEPTCONN, &listening, &len) < 0) {
+		setHandle(NINA_INVALID_HANDLE);
+		return -1;
+	}
+	if (listening == 0) {
+		setHandle(NINA_INVALID_HANDLE);
+		errno = NINA_BAD_ARG;
+		return -1;
+	}
+#else
+	NINA_UNUSED_ARG(listening);
+	NINA_UNUSED_ARG(len);
+#endif // !SO_ACCEPTCONN
+	return 0;
+}
+
+int
+SockAcceptor::steerByCPU(unsigned int groupSize)
+{
+	if (groupSize == 0) {
+		errno = NINA_BAD_ARG;
+		return -1;
+	}
+#if defined (SO_ATTACH_REUSEPORT_CBPF)
+	sock_filter	code[] = {
+		// A = CPU handling the packet
+		{BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<uint32_t> (SKF_AD_OFF + SKF_AD_CPU)},
+		// A = A % groupSize
+		{BPF_ALU | BPF_MOD | BPF_K, 0, 0, groupSize},
+		// Return A as the index of the socket in the group
+		{BPF_RET | BPF_A, 0, 0, 0}
+	};
+	sock_fprog	prog;
+
+	prog.len = sizeof code / sizeof *code;
+	prog.filter = code;
+	return setOption(SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof prog);
+#else
+	errno = ENOTSUP;
+	return -1;
+#endif // !SO_ATTACH_REUSEPORT_CBPF
+}
+
 NINA_END_NAMESPACE_DECL
@@ -19,6 +19,7 @@
  * @date Wed Oct 19 2011
  */
 
+#include <cstring>
 #include "NinaSockDatagram.hpp"
 
 NINA_BEGIN_NAMESPACE_DECL
@@ -88,6 +89,19 @@ SockDatagram::receiveFromPeer(std::string& str, Addr* peerAddr, uint8_t flags) c
 	return errCode;
 }
 
+int
+SockDatagram::receiveBatch(DatagramBatch& batch, uint8_t flags) const
+{
+	int	errCode;
+
+	errCode = OS::recvBatch(mTransportEndpoint, batch, flags);
+	if (errCode == NINA_ENDPOINT_ERROR) {
+		OS::setErrnoToWSALastError();
+		return -1;
+	}
+	return errCode;
+}
+
 int
 SockDatagram::sendToPeer(void const* buf, size_t bufLen, Addr const& peerAddr, uint8_t flag) const
 {
@@ -120,4 +134,178 @@ SockDatagram::exactSendToPeer(void const* buf, size_t bufLen, Addr const& peerAd
 	return bytesTransferred;
 }
 
+int
+SockDatagram::joinGroup(InetAddr const& group, unsigned int ifIndex) const
+{
+	return changeMembership(true, group, 0, ifIndex);
+}
+
+int
+SockDatagram::leaveGroup(InetAddr const& group, unsigned int ifIndex) const
+{
+	return changeMembership(false, group, 0, ifIndex);
+}
+
+int
+SockDatagram::joinSourceGroup(InetAddr const& group, InetAddr const& source, unsigned int ifIndex) const
+{
+	return changeMembership(true, group, &source, ifIndex);
+}
+
+int
+SockDatagram::leaveSourceGroup(InetAddr const& group, InetAddr const& source, unsigned int ifIndex) const
+{
+	return changeMembership(false, group, &source, ifIndex);
+}
+
+int
+SockDatagram::changeMembership(bool isJoining, InetAddr const& group, InetAddr const* source, unsigned int ifIndex) const
+{
+	int	level = (group.hasIpv6Addr() ? IPPROTO_IPV6 : IPPROTO_IP);
+
+	if (group.isMulticast() == false || (source != 0 && source->hasIpv6Addr() != group.hasIpv6Addr())) {
+		OS::setLastError(NINA_BAD_ARG);
+		return -1;
+	}
+#if defined (MCAST_JOIN_GROUP)
+	if (source == 0) {
+		group_req	req;
+
+		::memset(&req, 0, sizeof req);
+		req.gr_interface = ifIndex;
+		::memcpy(&req.gr_group, group.getAddr(), group.getSize());
+		return setOption(level, isJoining ? MCAST_JOIN_GROUP : MCAST_LEAVE_GROUP, &req, sizeof req);
+	}
+
+	group_source_req	req;
+
+	::memset(&req, 0, sizeof req);
+	req.gsr_interface = ifIndex;
+	::memcpy(&req.gsr_group, group.getAddr(), group.getSize());
+	::memcpy(&req.gsr_source, source->getAddr(), source->getSize());
+	return setOption(level, isJoining ? MCAST_JOIN_SOURCE_GROUP : MCAST_LEAVE_SOURCE_GROUP, &req, sizeof req);
+#else
+	if (source != 0) {
+		OS::setLastError(ENOTSUP);
+		return -1;
+	}
+	if (level == IPPROTO_IPV6) {
+		ipv6_mreq	req;
+
+		req.ipv6mr_multiaddr = static_cast<sockaddr_in6 const*> (group.getAddr())->sin6_addr;
+		req.ipv6mr_interface = ifIndex;
+		return setOption(level, isJoining ? IPV6_JOIN_GROUP : IPV6_LEAVE_GROUP, &req, sizeof req);
+	}
+
+	ip_mreq	req;
+
+	// The interface of an IPv4 membership is given by address here
+	if (ifIndex != 0) {
+		OS::setLastError(ENOTSUP);
+		return -1;
+	}
+	req.imr_multiaddr = static_cast<sockaddr_in const*> (group.getAddr())->sin_addr;
+	req.imr_interface.s_addr = htonl(INADDR_ANY);
+	return setOption(level, isJoining ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP, &req, sizeof req);
+#endif // !MCAST_JOIN_GROUP
+}
+
+int
+SockDatagram::setMulticastHops(int hops) const
+{
+	int	level = getMulticastLevel();
+
+	if (level == -1)
+		return -1;
+	return setOption(level, level == IPPROTO_IPV6 ? IPV6_MULTICAST_HOPS : IP_MULTICAST_TTL, &hops, sizeof hops);
+}
+
+int
+SockDatagram::setMulticastLoop(bool isEnabled) const
+{
+	int	level = getMulticastLevel();
+	int	value = (isEnabled ? 1 : 0);
+
+	if (level == -1)
+		return -1;
+	return setOption(level, level == IPPROTO_IPV6 ? IPV6_MULTICAST_LOOP : IP_MULTICAST_LOOP, &value, sizeof value);
+}
+
+int
+SockDatagram::setMulticastInterface(unsigned int ifIndex) const
+{
+	int	level = getMulticastLevel();
+
+	if (level == -1)
+		return -1;
+	if (level == IPPROTO_IPV6)
+		return setOption(level, IPV6_MULTICAST_IF, &ifIndex, sizeof ifIndex);
+#if defined (NINA_LINUX)
+	ip_mreqn	req;
+
+	::memset(&req, 0, sizeof req);
+	req.imr_ifindex = ifIndex;
+	return setOption(level, IP_MULTICAST_IF, &req, sizeof req);
+#elif defined (NINA_WIN32)
+	// An address of the form 0.0.0.x is taken as an interface index
+	DWORD	addr = htonl(ifIndex);
+
+	return setOption(level, IP_MULTICAST_IF, &addr, sizeof addr);
+#else
+	in_addr	addr;
+
+	if (ifIndex != 0) {
+		OS::setLastError(ENOTSUP);
+		return -1;
+	}
+	addr.s_addr = htonl(INADDR_ANY);
+	return setOption(level, IP_MULTICAST_IF, &addr, sizeof addr);
+#endif // !NINA_LINUX
+}
+
+int
+SockDatagram::setPacketInfo(bool isEnabled) const
+{
+	int	level = getMulticastLevel();
+	int	value = (isEnabled ? 1 : 0);
+
+	if (level == -1)
+		return -1;
+#if defined (IPV6_RECVPKTINFO)
+	if (level == IPPROTO_IPV6) {
+		if (setOption(level, IPV6_RECVPKTINFO, &value, sizeof value) < 0)
+			return -1;
+		// A dual stack socket also receives IPv4 datagrams, the error of a v6 only one does not matter
+# if defined (IP_PKTINFO)
+		setOption(IPPROTO_IP, IP_PKTINFO, &value, sizeof value);
+# endif // !IP_PKTINFO
+		return 0;
+	}
+#endif // !IPV6_RECVPKTINFO
+#if defined (IP_PKTINFO)
+	if (level == IPPROTO_IP)
+		return setOption(level, IP_PKTINFO, &value, sizeof value);
+#endif // !IP_PKTINFO
+	OS::setLastError(ENOTSUP);
+	return -1;
+}
+
+int
+SockDatagram::getMulticastLevel() const
+{
+	sockaddr_storage	addr;
+	int					addrLen = sizeof addr;
+
+	if (OS::getSockName(mTransportEndpoint, reinterpret_cast<sockaddr*> (&addr), &addrLen) == NINA_ENDPOINT_ERROR) {
+		OS::setErrnoToWSALastError();
+		return -1;
+	}
+	if (addr.ss_family == AF_INET6)
+		return IPPROTO_IPV6;
+	if (addr.ss_family == AF_INET)
+		return IPPROTO_IP;
+	OS::setLastError(NINA_BAD_ARG);
+	return -1;
+}
+
 NINA_END_NAMESPACE_DECL
@@ -21,6 +21,10 @@
 
 #include "NinaSockIO.hpp"
 
+#if defined (NINA_HAS_TIMESTAMPING)
+# include <linux/net_tstamp.h>
+#endif // !NINA_HAS_TIMESTAMPING
+
 NINA_BEGIN_NAMESPACE_DECL
 
 SockIO::SockIO()
@@ -76,6 +80,19 @@ SockIO::receive(std::string& str, uint8_t flags) const
 	return errCode;
 }
 
+int
+SockIO::receive(void* buf, size_t bufLen, Time& stamp, uint8_t flags) const
+{
+	int	errCode;
+
+	errCode = OS::recvTimestamped(mTransportEndpoint, buf, bufLen, flags, &stamp);
+	if (errCode == NINA_ENDPOINT_ERROR) {
+		OS::setErrnoToWSALastError();
+		return -1;
+	}
+	return errCode;
+}
+
 int
 SockIO::send(void const* buf, size_t bufLen, uint8_t flag) const
 {
@@ -89,4 +106,49 @@ SockIO::send(void const* buf, size_t bufLen, uint8_t flag) const
 	return errCode;
 }
 
+int
+SockIO::setTimestamping(uint8_t flags) const
+{
+#if defined (NINA_HAS_TIMESTAMPING)
+	int	value = 0;
+
+	if (flags & RX_TIMESTAMP)
+		value |= SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+	if (flags & TX_TIMESTAMP)
+		// Each timestamp carries the identifier of its send, without looping back the payload
+		value |= SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_TX_ACK | SOF_TIMESTAMPING_SOFTWARE
+			| SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+	return setOption(SOL_SOCKET, SO_TIMESTAMPING, &value, sizeof value);
+#else
+	if (flags == 0)
+		return 0;
+	OS::setLastError(ENOTSUP);
+	return -1;
+#endif // !NINA_HAS_TIMESTAMPING
+}
+
+int
+SockIO::receiveSendTimestamps(std::vector<SendTimestamp>& stamps, size_t max) const
+{
+	SendTimestamp	stamp;
+	int				count = 0;
+	int				errCode;
+
+	for (size_t i = 0; i < max; ++i) {
+		errCode = OS::recvSendTimestamp(mTransportEndpoint, &stamp);
+		if (errCode == NINA_ENDPOINT_ERROR) {
+			OS::setErrnoToWSALastError();
+			// An empty error queue ends the collection
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+			return -1;
+		}
+		if (errCode == 1) {
+			stamps.push_back(stamp);
+			++count;
+		}
+	}
+	return count;
+}
+
 NINA_END_NAMESPACE_DECL
@@ -0,0 +1,145 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaSocketProfile.cpp
+ * @brief Implements the TCP tuning profiles of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include "NinaSocketProfile.hpp"
+
+#if defined (NINA_POSIX)
+# include <netinet/in.h>
+# include <netinet/tcp.h>
+#endif // !NINA_POSIX
+
+NINA_BEGIN_NAMESPACE_DECL
+
+//! Unsupported option
+#define UNSUPPORTED -1
+
+SocketProfile::OptionInfo const SocketProfile::msOptions[OPTION_COUNT] =
+{
+	{IPPROTO_TCP, TCP_NODELAY, TCP_NODELAY, INHERITED | CONNECTOR},
+#if defined (TCP_QUICKACK)
+	// Delayed acknowledgments are turned back on by the kernel, thus it is never inherited
+	{IPPROTO_TCP, TCP_QUICKACK, TCP_QUICKACK, ACCEPTED | CONNECTOR},
+#else
+	{IPPROTO_TCP, UNSUPPORTED, UNSUPPORTED, 0},
+#endif // !TCP_QUICKACK
+#if defined (TCP_DEFER_ACCEPT)
+	{IPPROTO_TCP, TCP_DEFER_ACCEPT, UNSUPPORTED, LISTENER},
+#else
+	{IPPROTO_TCP, UNSUPPORTED, UNSUPPORTED, 0},
+#endif // !TCP_DEFER_ACCEPT
+#if defined (TCP_FASTOPEN) && defined (TCP_FASTOPEN_CONNECT)
+	{IPPROTO_TCP, TCP_FASTOPEN, TCP_FASTOPEN_CONNECT, LISTENER | CONNECTOR},
+#elif defined (TCP_FASTOPEN)
+	{IPPROTO_TCP, TCP_FASTOPEN, UNSUPPORTED, LISTENER},
+#else
+	{IPPROTO_TCP, UNSUPPORTED, UNSUPPORTED, 0},
+#endif // !TCP_FASTOPEN
+	{SOL_SOCKET, SO_RCVBUF, SO_RCVBUF, INHERITED | CONNECTOR},
+	{SOL_SOCKET, SO_SNDBUF, SO_SNDBUF, INHERITED | CONNECTOR},
+#if defined (TCP_NOTSENT_LOWAT)
+	{IPPROTO_TCP, TCP_NOTSENT_LOWAT, TCP_NOTSENT_LOWAT, INHERITED | CONNECTOR},
+#else
+	{IPPROTO_TCP, UNSUPPORTED, UNSUPPORTED, 0},
+#endif // !TCP_NOTSENT_LOWAT
+#if defined (SO_BUSY_POLL)
+	{SOL_SOCKET, SO_BUSY_POLL, SO_BUSY_POLL, INHERITED | CONNECTOR},
+#else
+	{SOL_SOCKET, UNSUPPORTED, UNSUPPORTED, 0},
+#endif // !SO_BUSY_POLL
+	{SOL_SOCKET, SO_KEEPALIVE, SO_KEEPALIVE, INHERITED | CONNECTOR}
+};
+
+SocketProfile::SocketProfile()
+{
+	for (int i = 0; i < OPTION_COUNT; ++i)
+		mValues[i] = -1;
+}
+
+SocketProfile::~SocketProfile()
+{
+}
+
+SocketProfile::SocketProfile(SocketProfile const& profile)
+{
+	for (int i = 0; i < OPTION_COUNT; ++i)
+		mValues[i] = profile.mValues[i];
+}
+
+SocketProfile&
+SocketProfile::operator=(SocketProfile const& profile)
+{
+	if (this != &profile) {
+		for (int i = 0; i < OPTION_COUNT; ++i)
+			mValues[i] = profile.mValues[i];
+	}
+	return *this;
+}
+
+SocketProfile
+SocketProfile::lowLatency()
+{
+	SocketProfile	profile;
+
+	profile.setNoDelay(true).setQuickAck(true).setNotSentLowat(16384);
+	return profile;
+}
+
+SocketProfile
+SocketProfile::bulkThroughput()
+{
+	SocketProfile	profile;
+
+	profile.setNoDelay(false).setReceiveBuffer(4194304).setSendBuffer(4194304).setKeepAlive(true);
+	return profile;
+}
+
+bool
+SocketProfile::isEmpty() const
+{
+	for (int i = 0; i < OPTION_COUNT; ++i)
+		if (mValues[i] >= 0)
+			return false;
+	return true;
+}
+
+int
+SocketProfile::apply(Sock& sock, Scope scope) const
+{
+	int	name;
+	int	value;
+
+	for (int i = 0; i < OPTION_COUNT; ++i) {
+		if (mValues[i] < 0 || (msOptions[i].scope & scope) == 0)
+			continue;
+		name = (scope == CONNECTOR ? msOptions[i].connectName : msOptions[i].name);
+		if (name == UNSUPPORTED)
+			continue;
+		value = mValues[i];
+		// A connecting socket only enables fast open, the queue belongs to the listening one
+		if (i == FAST_OPEN && scope == CONNECTOR)
+			value = (value > 0);
+		if (sock.setOption(msOptions[i].level, name, &value, sizeof value) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+NINA_END_NAMESPACE_DECL
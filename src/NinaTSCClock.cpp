@@ -0,0 +1,115 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaTSCClock.cpp
+ * @brief Implements the time stamp counter clock of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include "NinaDef.hpp"
+#include "NinaTSCClock.hpp"
+
+#if defined (NINA_HAS_TSC)
+# include <cpuid.h>
+#endif // !NINA_HAS_TSC
+
+NINA_BEGIN_NAMESPACE_DECL
+
+TSCClock::TSCClock()
+	: mIsTSC(isSupported()),
+	mNSecPerTick(1.0)
+{
+	calibrate();
+}
+
+TSCClock::~TSCClock()
+{
+}
+
+TSCClock::TSCClock(TSCClock const& clock)
+	: mIsTSC(clock.mIsTSC),
+	mNSecPerTick(clock.mNSecPerTick)
+{
+}
+
+TSCClock&
+TSCClock::operator=(TSCClock const& clock)
+{
+	if (this != &clock) {
+		mIsTSC = clock.mIsTSC;
+		mNSecPerTick = clock.mNSecPerTick;
+	}
+	return *this;
+}
+
+bool
+TSCClock::isSupported()
+{
+#if defined (NINA_HAS_TSC)
+	unsigned int	eax;
+	unsigned int	ebx;
+	unsigned int	ecx;
+	unsigned int	edx;
+
+	// Invariant TSC flag of the advanced power management leaf
+	if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007)
+		return false;
+	if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0)
+		return false;
+	return (edx & (1 << 8)) != 0;
+#else
+	return false;
+#endif // !NINA_HAS_TSC
+}
+
+int
+TSCClock::calibrate(Time const& duration)
+{
+	Time		start(0, 0);
+	Time		elapsed(0, 0);
+	uint64_t	startTicks;
+	uint64_t	endTicks;
+	double		nsec;
+
+	// The monotonic clock already counts nanoseconds
+	if (mIsTSC == false) {
+		mNSecPerTick = 1.0;
+		return 0;
+	}
+	if (start.monotonic() < 0)
+		return -1;
+	startTicks = read();
+	do {
+		if (elapsed.monotonic() < 0)
+			return -1;
+		endTicks = read();
+		elapsed -= start;
+	}
+	while (elapsed < duration);
+	nsec = static_cast<double> (elapsed.getNanoseconds());
+	if (endTicks <= startTicks || nsec <= 0)
+		return -1;
+	mNSecPerTick = nsec / static_cast<double> (endTicks - startTicks);
+	return 0;
+}
+
+Time
+TSCClock::toTime(uint64_t ticks) const
+{
+	return Time::fromNanoseconds(static_cast<int64_t> (toNanoseconds(ticks)));
+}
+
+NINA_END_NAMESPACE_DECL
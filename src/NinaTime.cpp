@@ -25,138 +25,4 @@ NINA_BEGIN_NAMESPACE_DECL
 
 Time const Time::timeNull(0, 0);
 
-Time::Time(time_t sec, long uSec)
-{
-	set(sec, uSec);
-	if (sec != 0 || uSec != 0)
-		normalize();
-}
-
-Time::~Time()
-{
-}
-
-Time::Time(Time const& time)
-{
-#if defined (NINA_WIN32)
-	::memcpy(&mExportTimeValue, &time.mExportTimeValue, sizeof mExportTimeValue);
-#endif // !NINA_WIN32
-	::memcpy(&mTimeValue, &time.mTimeValue, sizeof mTimeValue);
-}
-
-Time&
-Time::operator=(Time const& time)
-{
-	if (this != &time) {
-#if defined (NINA_WIN32)
-		::memcpy(&mExportTimeValue, &time.mExportTimeValue, sizeof(mExportTimeValue));
-#endif // !NINA_WIN32
-		::memcpy(&mTimeValue, &time.mTimeValue, sizeof mTimeValue);
-	}
-	return *this;
-}
-
-Time&
-Time::operator+=(Time const& time)
-{
-	if (time != timeNull) {
-		mTimeValue.tv_sec += time.mTimeValue.tv_sec;
-		mTimeValue.tv_usec += time.mTimeValue.tv_usec;
-		normalize();
-	}
-	return *this;
-}
-
-Time&
-Time::operator-=(Time const& time)
-{
-	if (time != timeNull) {
-		mTimeValue.tv_sec -= time.mTimeValue.tv_sec;
-		mTimeValue.tv_usec -= time.mTimeValue.tv_usec;
-		normalize();
-	}
-	return *this;
-}
-
-Time&
-Time::operator*=(double factor)
-{
-	if (factor == 0)
-		*this = timeNull;
-	else {
-		mTimeValue.tv_sec = static_cast<time_t> (mTimeValue.tv_sec * factor);
-		mTimeValue.tv_usec = static_cast<long> (mTimeValue.tv_usec * factor);
-		normalize();
-	}
-	return *this;
-}
-
-Time
-Time::operator+(Time const& time)
-{
-	Time copy(*this);
-
-	if (time != timeNull) {
-		copy += time;
-		normalize();
-	}
-	return copy;
-}
-
-Time
-Time::operator-(Time const& time)
-{
-	Time copy(*this);
-
-	if (time != timeNull) {
-		copy -= time;
-		normalize();
-	}
-	return copy;
-}
-
-Time
-Time::operator*(double factor)
-{
-	Time copy(*this);
-
-	if (factor == 0)
-		return Time(timeNull);
-	copy *= factor;
-	normalize();
-	return copy;
-}
-
-void
-Time::operator++()
-{
-	mTimeValue.tv_sec += 1;
-	mTimeValue.tv_usec += 1;
-	normalize();
-}
-
-void
-Time::operator--()
-{
-	mTimeValue.tv_sec -= 1;
-	mTimeValue.tv_usec -= 1;
-	normalize();
-}
-
-void
-Time::normalize()
-{
-	time_t tmp;
-
-	tmp = mTimeValue.tv_sec + mTimeValue.tv_usec / SEC_IN_USEC;
-	if (tmp >= 0) {
-		mTimeValue.tv_sec = tmp;
-		mTimeValue.tv_usec %= SEC_IN_USEC;
-	}
-	while (mTimeValue.tv_sec > 0 && mTimeValue.tv_usec < 0) {
-		--mTimeValue.tv_sec;
-		mTimeValue.tv_usec += SEC_IN_USEC;
-	}
-}
-
 NINA_END_NAMESPACE_DECL
@@ -0,0 +1,92 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+
+/*!
+ * @file NinaTimerQueue.cpp
+ * @brief Implements the timer queue of NINA api
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include "NinaTimerQueue.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+TimerQueue::TimerQueue()
+	: mNextId(0)
+{
+}
+
+TimerQueue::~TimerQueue()
+{
+}
+
+long
+TimerQueue::schedule(EventHandler* eHandler, Time const& deadline)
+{
+	Deadlines::iterator	i;
+
+	if (eHandler == 0)
+		return -1;
+	i = mDeadlines.insert(std::make_pair(deadline, mNextId));
+	mTimers[mNextId] = std::make_pair(eHandler, i);
+	return mNextId++;
+}
+
+int
+TimerQueue::cancel(long timerId)
+{
+	Timers::iterator	i;
+
+	i = mTimers.find(timerId);
+	if (i == mTimers.end())
+		return -1;
+	mDeadlines.erase(i->second.second);
+	mTimers.erase(i);
+	return 0;
+}
+
+size_t
+TimerQueue::expire(Time const& now)
+{
+	Deadlines::iterator	i;
+	Timers::iterator	j;
+	EventHandler*		eHandler;
+	long				timerId;
+	long				lastId = mNextId;
+	size_t				count = 0;
+
+	i = mDeadlines.begin();
+	while (i != mDeadlines.end() && i->first <= now) {
+		// Timers scheduled during this dispatch wait for the next one, avoiding endless loops on null delays
+		if (i->second >= lastId) {
+			++i;
+			continue;
+		}
+		timerId = i->second;
+		j = mTimers.find(timerId);
+		eHandler = j->second.first;
+		mTimers.erase(j);
+		mDeadlines.erase(i);
+		++count;
+		if (eHandler->handleTimer(timerId) == -1)
+			eHandler->handleClose(eHandler->getHandle());
+		// Handlers may schedule or cancel timers, thus the iteration starts over
+		i = mDeadlines.begin();
+	}
+	return count;
+}
+
+NINA_END_NAMESPACE_DECL
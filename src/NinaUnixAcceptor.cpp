@@ -0,0 +1,72 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixAcceptor.cpp
+ * @brief Implements the passive connection establishment of the unix domain sockets
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <unistd.h>
+#include "NinaUnixAcceptor.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+UnixAcceptor::UnixAcceptor()
+	: SockAcceptor()
+{
+}
+
+UnixAcceptor::~UnixAcceptor()
+{
+}
+
+UnixAcceptor::UnixAcceptor(UnixAcceptor const& sap)
+	: SockAcceptor(sap)
+{
+}
+
+UnixAcceptor&
+UnixAcceptor::operator=(UnixAcceptor const& sap)
+{
+	if (this != &sap)
+		SockAcceptor::operator=(sap);
+	return *this;
+}
+
+int
+UnixAcceptor::open(Addr const& addr, int family, int protocol, bool reuseAddr, int backlog, bool reusePort,
+		SocketProfile const* profile)
+{
+	NINA_UNUSED_ARG(family);
+	NINA_UNUSED_ARG(protocol);
+	return SockAcceptor::open(addr, AF_UNIX, ANY_PROTO, reuseAddr, backlog, reusePort, profile);
+}
+
+int
+UnixAcceptor::remove()
+{
+	UnixAddr	addr;
+	int			errCode;
+
+	errCode = getLocalAddr(addr);
+	if (close() < 0)
+		return -1;
+	if (errCode == 0 && addr.isUnnamed() == false && addr.isAbstract() == false)
+		return ::unlink(addr.getPath().c_str());
+	return errCode;
+}
+
+NINA_END_NAMESPACE_DECL
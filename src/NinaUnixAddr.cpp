@@ -0,0 +1,135 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixAddr.cpp
+ * @brief Implements the unix domain addressing
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include "NinaUnixAddr.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+UnixAddr::UnixAddr()
+	: Addr(AF_UNIX, offsetof(sockaddr_un, sun_path))
+{
+	reset();
+}
+
+UnixAddr::UnixAddr(std::string const& path, bool abstract)
+	: Addr(AF_UNIX, offsetof(sockaddr_un, sun_path))
+{
+	if (setPath(path, abstract) < 0)
+		throw std::invalid_argument("Invalid unix domain path");
+}
+
+UnixAddr::~UnixAddr()
+{
+}
+
+UnixAddr::UnixAddr(UnixAddr const& sap)
+	: Addr(sap)
+{
+	::memcpy(&mUnixAddr, &sap.mUnixAddr, sizeof mUnixAddr);
+}
+
+UnixAddr&
+UnixAddr::operator=(UnixAddr const& sap)
+{
+	if (this != &sap) {
+		Addr::operator=(sap);
+		::memcpy(&mUnixAddr, &sap.mUnixAddr, sizeof mUnixAddr);
+	}
+	return *this;
+}
+
+// The bytes past the size are not part of the address (abstract names are not null terminated)
+bool
+UnixAddr::operator==(UnixAddr const& sap) const
+{
+	if (mSize != sap.mSize)
+		return false;
+	return ::memcmp(mUnixAddr.sun_path, sap.mUnixAddr.sun_path, mSize - offsetof(sockaddr_un, sun_path)) == 0;
+}
+
+int
+UnixAddr::setAddr(void* addr, size_t addrLen)
+{
+	sockaddr const*	sa = static_cast<sockaddr const*> (addr);
+
+	reset();
+	if (addrLen > sizeof(sockaddr_un) || (addrLen >= sizeof(sa->sa_family) && sa->sa_family != AF_UNIX))
+		return -1;
+	::memcpy(&mUnixAddr, addr, addrLen);
+	mUnixAddr.sun_family = AF_UNIX;
+	// Filesystem paths may be reported with their null character
+	while (addrLen > offsetof(sockaddr_un, sun_path) + 1 && mUnixAddr.sun_path[0] != '\0' &&
+			reinterpret_cast<char const*> (&mUnixAddr)[addrLen - 1] == '\0')
+		--addrLen;
+	if (addrLen < offsetof(sockaddr_un, sun_path))
+		addrLen = offsetof(sockaddr_un, sun_path);
+	setSize(addrLen);
+	return 0;
+}
+
+int
+UnixAddr::setPath(std::string const& path, bool abstract)
+{
+	size_t	offset = (abstract ? 1 : 0);
+
+	reset();
+#if !defined (NINA_LINUX)
+	if (abstract == true) {
+		errno = ENOTSUP;
+		return -1;
+	}
+#endif // !NINA_LINUX
+	// Filesystem paths keep room for their null character
+	if (path.size() + offset + (abstract ? 0 : 1) > sizeof(mUnixAddr.sun_path)) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+	::memcpy(mUnixAddr.sun_path + offset, path.data(), path.size());
+	setSize(offsetof(sockaddr_un, sun_path) + offset + path.size());
+	return 0;
+}
+
+std::string
+UnixAddr::getPath() const
+{
+	size_t	len;
+
+	if (isUnnamed())
+		return std::string();
+	len = mSize - offsetof(sockaddr_un, sun_path);
+	if (isAbstract())
+		return std::string(mUnixAddr.sun_path + 1, len - 1);
+	return std::string(mUnixAddr.sun_path, ::strnlen(mUnixAddr.sun_path, len));
+}
+
+void
+UnixAddr::reset()
+{
+	::memset(&mUnixAddr, 0, sizeof mUnixAddr);
+	mUnixAddr.sun_family = AF_UNIX;
+	mFamily = AF_UNIX;
+	mSize = offsetof(sockaddr_un, sun_path);
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,61 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixDatagram.cpp
+ * @brief Implements the unix domain datagram sockets
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include "NinaUnixDatagram.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+UnixDatagram::UnixDatagram()
+{
+}
+
+UnixDatagram::~UnixDatagram()
+{
+}
+
+UnixDatagram::UnixDatagram(UnixDatagram const& sap)
+	: SockDatagram(sap)
+{
+}
+
+UnixDatagram&
+UnixDatagram::operator=(UnixDatagram const& sap)
+{
+	if (this != &sap)
+		SockDatagram::operator=(sap);
+	return *this;
+}
+
+int
+UnixDatagram::pair(UnixDatagram& first, UnixDatagram& second)
+{
+	NINAHandle	handles[2];
+
+	if (::socketpair(AF_UNIX, SOCK_DGRAM, 0, handles) < 0)
+		return -1;
+	first.close();
+	second.close();
+	first.setHandle(handles[0]);
+	second.setHandle(handles[1]);
+	return 0;
+}
+
+NINA_END_NAMESPACE_DECL
@@ -0,0 +1,167 @@
+// Copyright (c) 2011, Jonathan Calmels <jbjcalmels@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software for any
+// purpose with or without fee is hereby granted, provided that the above
+// copyright notice and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+// WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+// ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+// WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+// ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+// OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+/*!
+ * @file NinaUnixStream.cpp
+ * @brief Implements the unix domain stream sockets
+ * @author Jonathan Calmels
+ * @date Mon Oct 19 2026
+ */
+
+#include <cstring>
+#include <unistd.h>
+#include <fcntl.h>
+#include "NinaUnixStream.hpp"
+
+NINA_BEGIN_NAMESPACE_DECL
+
+UnixStream::UnixStream()
+{
+}
+
+UnixStream::~UnixStream()
+{
+}
+
+UnixStream::UnixStream(UnixStream const& sap)
+	: SockStream(sap)
+{
+}
+
+UnixStream&
+UnixStream::operator=(UnixStream const& sap)
+{
+	if (this != &sap)
+		SockStream::operator=(sap);
+	return *this;
+}
+
+int
+UnixStream::pair(UnixStream& first, UnixStream& second)
+{
+	NINAHandle	handles[2];
+
+	if (::socketpair(AF_UNIX, SOCK_STREAM, 0, handles) < 0)
+		return -1;
+	first.close();
+	second.close();
+	first.setHandle(handles[0]);
+	second.setHandle(handles[1]);
+	return 0;
+}
+
+int
+UnixStream::sendHandles(NINAHandle const* handles, size_t count, void const* buf, size_t bufLen) const
+{
+	std::vector<char>	control(CMSG_SPACE(count * sizeof(NINAHandle)));
+	msghdr				msg;
+	iovec				iov;
+	cmsghdr*			cmsg;
+	int					errCode;
+
+	// Ancillary data is attached to the payload, a stream cannot carry it alone
+	if (bufLen == 0 || count > MAX_HANDLES) {
+		errno = NINA_BAD_ARG;
+		return -1;
+	}
+	::memset(&msg, 0, sizeof msg);
+	iov.iov_base = const_cast<void*> (buf);
+	iov.iov_len = bufLen;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	if (count > 0) {
+		msg.msg_control = &control[0];
+		msg.msg_controllen = control.size();
+		cmsg = CMSG_FIRSTHDR(&msg);
+		cmsg->cmsg_level = SOL_SOCKET;
+		cmsg->cmsg_type = SCM_RIGHTS;
+		cmsg->cmsg_len = CMSG_LEN(count * sizeof(NINAHandle));
+		::memcpy(CMSG_DATA(cmsg), handles, count * sizeof(NINAHandle));
+	}
+	do
+		errCode = ::sendmsg(mTransportEndpoint, &msg, 0);
+	while (errCode == -1 && errno == EINTR);
+	return errCode;
+}
+
+int
+UnixStream::receiveHandles(std::vector<NINAHandle>& handles, void* buf, size_t bufLen, size_t maxCount) const
+{
+	std::vector<char>	control(CMSG_SPACE((maxCount > MAX_HANDLES ? static_cast<size_t> (MAX_HANDLES) : maxCount) * sizeof(NINAHandle)));
+	msghdr				msg;
+	iovec				iov;
+	cmsghdr*			cmsg;
+	size_t				count;
+	size_t				first = handles.size();
+	int					flags = 0;
+	int					errCode;
+
+	::memset(&msg, 0, sizeof msg);
+	iov.iov_base = buf;
+	iov.iov_len = bufLen;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = &control[0];
+	msg.msg_controllen = control.size();
+#if defined (MSG_CMSG_CLOEXEC)
+	flags |= MSG_CMSG_CLOEXEC;
+#endif // !MSG_CMSG_CLOEXEC
+	do
+		errCode = ::recvmsg(mTransportEndpoint, &msg, flags);
+	while (errCode == -1 && errno == EINTR);
+	if (errCode < 0)
+		return -1;
+	for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != 0; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+			continue;
+		count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(NINAHandle);
+		for (size_t i = 0; i < count; ++i) {
+			NINAHandle	handle;
+
+			::memcpy(&handle, CMSG_DATA(cmsg) + i * sizeof(NINAHandle), sizeof handle);
+#if !defined (MSG_CMSG_CLOEXEC)
+			::fcntl(handle, F_SETFD, FD_CLOEXEC);
+#endif // !MSG_CMSG_CLOEXEC
+			handles.push_back(handle);
+		}
+	}
+	// Some handles were dropped, the ones received are useless without them
+	if (msg.msg_flags & MSG_CTRUNC) {
+		for (size_t i = first; i < handles.size(); ++i)
+			::close(handles[i]);
+		handles.resize(first);
+		errno = EMSGSIZE;
+		return -1;
+	}
+	return errCode;
+}
+
+int
+UnixStream::receiveHandles(std::vector<NINAHandle>& handles, std::string& str, size_t maxCount) const
+{
+	std::vector<char>	data(str.capacity());
+	int					errCode;
+
+	if (data.empty()) {
+		errno = NINA_BAD_ARG;
+		return -1;
+	}
+	errCode = receiveHandles(handles, &data[0], data.size(), maxCount);
+	if (errCode < 0)
+		return -1;
+	str.assign(&data[0], errCode);
+	return errCode;
+}
+
+NINA_END_NAMESPACE_DECL
@@ -17,9 +17,17 @@
 
 void testAddr();
 void testSock();
+void testAccept();
+#if defined (NINA_POSIX)
+void testUnix();
+#endif // !NINA_POSIX
 void testTime();
 void testIOContainer();
 void testReactor();
+void testConnector();
+void testPool();
+void testOverload();
+void testDrain();
 void testPacket();
 
 int 			main(void)
@@ -44,8 +52,16 @@ int 			main(void)
 	testIOContainer();
 	std::cout << "-------------- TESTING SOCKETS --------------" << std::endl << std::endl;
 	testSock();
+	testAccept();
+#if defined (NINA_POSIX)
+	testUnix();
+#endif // !NINA_POSIX
 	std::cout << "-------------- TESTING REACTOR --------------" << std::endl << std::endl;
 	testReactor();
+	testConnector();
+	testPool();
+	testOverload();
+	testDrain();
 	std::cout << "-------------- TESTING PACKET --------------" << std::endl << std::endl;
 	testPacket();
 	return 0;
@@ -15,6 +15,98 @@
 #include <iostream>
 #include <nina.h>
 
+#if defined (NINA_POSIX)
+# include <netdb.h>
+
+class Resolved : public NINA::ResolveHandler
+{
+	public:
+		Resolved() : mCount(0), mError(0), mAddrs(AF_UNSPEC) {};
+
+	public:
+		virtual void handleResolve(std::string const&, NINA::InetAddrList const& addrs, int error)
+		{
+			++mCount;
+			mError = error;
+			mAddrs = addrs;
+		};
+
+	public:
+		int					mCount;
+		int					mError;
+		NINA::InetAddrList	mAddrs;
+};
+
+// Stub resolver only knowing one name
+class StubResolver : public NINA::Resolver
+{
+	protected:
+		virtual int lookup(std::string const& host, int protocol, NINA::InetAddrList& addrs)
+		{
+			if (host != "stub.test")
+				return EAI_NONAME;
+			return addrs.resolve("192.0.2.1", "0", protocol, 0);
+		};
+};
+
+static void	testResolver()
+{
+	NINA::Reactor<NINA::PollPolicy>	react;
+	NINA::Time						wait(0, 100000);
+	Resolved						first;
+	Resolved						second;
+	Resolved						cached;
+
+	{
+		NINA::Resolver	resolver;
+
+		react.registerHandler(&resolver, NINA::Events::READ);
+		std::cout << "Resolving /etc/hosts names asynchronously ... ";
+		if (resolver.resolve("localhost", 80, &first) != 0 || resolver.resolve("localhost", 8080, &second) != 0)
+			std::cout << "[FAILED]" << std::endl;
+		else {
+			for (int i = 0; i < 50 && second.mCount == 0; ++i)
+				react.handleEvents(&wait);
+			// Both lookups are coalesced into a single one
+			if (first.mCount != 1 || second.mCount != 1 || resolver.getLookupCount() != 1 ||
+					first.mAddrs.empty() == true ||
+					(first.mAddrs[0].isLoopback() == false && first.mAddrs[0].getHostAddr() != "127.0.0.1") ||
+					first.mAddrs[0].getPortByNumber() != 80 || second.mAddrs[0].getPortByNumber() != 8080)
+				std::cout << "[FAILED]" << std::endl;
+			else
+				std::cout << "[OK]" << std::endl;
+		}
+		std::cout << "Resolving from the cache ... ";
+		if (resolver.resolve("localhost", 80, &cached) != 1 || cached.mCount != 1 || resolver.getCacheHits() != 1 ||
+				resolver.resolve("127.0.0.1", 80, &cached) != 1 || cached.mCount != 2 || resolver.getLookupCount() != 1)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+		react.removeHandler(&resolver, NINA::Events::READ);
+	}
+	{
+		StubResolver	resolver;
+		Resolved		unknown;
+		Resolved		stub;
+
+		react.registerHandler(&resolver, NINA::Events::READ);
+		std::cout << "Caching unknown names ... ";
+		resolver.resolve("unknown.test", 80, &unknown);
+		resolver.resolve("stub.test", 80, &stub);
+		for (int i = 0; i < 50 && (unknown.mCount == 0 || stub.mCount == 0); ++i)
+			react.handleEvents(&wait);
+		if (unknown.mError != EAI_NONAME || stub.mError != 0 || stub.mAddrs.size() != 1 ||
+				resolver.resolve("unknown.test", 80, &unknown) != 1 || unknown.mCount != 2 ||
+				unknown.mError != EAI_NONAME || resolver.getLookupCount() != 2)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+		react.removeHandler(&resolver, NINA::Events::READ);
+	}
+	std::cout << std::endl;
+}
+#endif // !NINA_POSIX
+
 void		testAddr()
 {
 	if (NINA::Addr::sapAny == NINA::Addr::sapAny)
@@ -163,6 +255,67 @@ void		testAddr()
 		}
 	}
 	std::cout << std::endl;
+	{
+		NINA::NetTables const&	tables = NINA::NetTables::getTables();
+		std::string				name;
+
+		std::cout << "Looking up the cached protocol and service tables ... ";
+		if (tables.getProtocolNumber("tcp") != IPPROTO_TCP || tables.getProtocolName(IPPROTO_UDP, name) < 0 ||
+				name != "udp" || tables.getServicePort("www", "tcp") != 80 || tables.getServicePort("http", 0) != 80 ||
+				tables.getServiceName(80, "tcp", name) < 0 || name != "http" || tables.getProtocolNumber("nothing") != -1)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+	{
+		NINA::InetAddr	v4;
+		NINA::InetAddr	mapped(AF_INET6);
+		NINA::InetAddr	v6;
+
+		v4.remoteQuery("192.0.2.1", 5000, IPPROTO_UDP, 0);
+		mapped.remoteQuery("::ffff:192.0.2.1", 5000, IPPROTO_UDP, 0);
+		v6.remoteQuery("2001:db8::1", 5000, IPPROTO_UDP, 0);
+		std::cout << "Folding IPv4-mapped addresses into their key ... ";
+		if (NINA::InetAddrKey(v4) != NINA::InetAddrKey(mapped) || NINA::InetAddrKey(v4).getHash() != NINA::InetAddrKey(mapped).getHash()
+				|| NINA::InetAddrKey(v4).getFamily() != AF_INET || NINA::InetAddrKey(v4).getPort() != 5000
+				|| NINA::InetAddrKey(v4) == NINA::InetAddrKey(v6) || NINA::InetAddrKey(NINA::InetAddr()).isNull() == false)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+
+		NINA::InetAddrMap<int>	map(4);
+		NINA::InetAddr			peer;
+		bool					isValid = true;
+
+		// Enough peers to grow the table several times, then every other one is erased
+		std::cout << "Looking up peers in an address map ... ";
+		for (uint16_t port = 1; port <= 1000; ++port) {
+			peer = v4;
+			peer.setPort(port);
+			map[NINA::InetAddrKey(peer)] = port;
+		}
+		for (uint16_t port = 1; port <= 1000; port += 2) {
+			peer = v4;
+			peer.setPort(port);
+			isValid = isValid && map.erase(NINA::InetAddrKey(peer));
+		}
+		for (uint16_t port = 1; port <= 1000; ++port) {
+			peer = v4;
+			peer.setPort(port);
+			int*	value = map.find(NINA::InetAddrKey(peer));
+
+			isValid = isValid && ((port % 2) ? value == 0 : (value != 0 && *value == port));
+		}
+		if (isValid == false || map.size() != 500 || map.insert(NINA::InetAddrKey(v6), 7) == 0
+				|| *map.insert(NINA::InetAddrKey(v6), 8) != 7 || map.insert(NINA::InetAddrKey(), 1) != 0)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+	std::cout << std::endl;
+#if defined (NINA_POSIX)
+	testResolver();
+#endif // !NINA_POSIX
 
 #if defined (NINA_WIN32)
 	system("pause");
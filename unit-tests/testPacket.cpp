@@ -16,6 +16,7 @@
 #include <iterator>
 #include <iomanip>
 #include <sstream>
+#include <stdexcept>
 #include <iostream>
 #include <nina.h>
 
@@ -28,6 +29,225 @@ void		hexDump(std::string const& src)
 	std::cout << dump.str() << std::endl;
 }
 
+struct		Move
+{
+	NINA::CDR::UInteger	id;
+	NINA::CDR::Short	x;
+	NINA::CDR::Short	y;
+	NINA::CDR::Boolean	run;
+};
+
+typedef NINA::Layout<NINA::Field<Move, NINA::CDR::UInteger, &Move::id>,
+		NINA::Field<Move, NINA::CDR::Short, &Move::x>,
+		NINA::Field<Move, NINA::CDR::Short, &Move::y>,
+		NINA::Field<Move, NINA::CDR::Boolean, &Move::run> > MoveLayout;
+
+struct		Chat
+{
+	NINA::CDR::UShort	channel;
+	NINA::CDR::String	text;
+	NINA::CDR::Long		stamp;
+};
+
+typedef NINA::Layout<NINA::Field<Chat, NINA::CDR::UShort, &Chat::channel>,
+		NINA::Field<Chat, NINA::CDR::String, &Chat::text>,
+		NINA::Field<Chat, NINA::CDR::Long, &Chat::stamp> > ChatLayout;
+
+void		testMarshal()
+{
+	NINA::OutputPacket	opacket;
+	NINA::OutputPacket	fpacket;
+	NINA::InputPacket	ipacket;
+	Move				move = {0xAABBCCDD, -2, 300, true};
+	Move				rmove;
+	Chat				chat;
+	Chat				rchat;
+	bool				ok;
+
+	NINA::Marshal<Move, MoveLayout>::encode(opacket, move);
+	fpacket << move.id << move.x << move.y << move.run;
+	std::cout << "Marshal fixed size :	" << NINA::Marshal<Move, MoveLayout>::FIXED << " "
+		<< std::dec << NINA::Marshal<Move, MoveLayout>::SIZE << " (should be 1 9) ";
+	std::cout << ((opacket == fpacket) ? "[OK]" : "[FAILED]") << std::endl;
+	std::cout << "Marshal dump :		";
+	hexDump(opacket.dump());
+
+	ipacket.assign(opacket.dump());
+	if (NINA::Marshal<Move, MoveLayout>::decode(ipacket, rmove) == 0 && rmove.id == move.id &&
+			rmove.x == move.x && rmove.y == move.y && rmove.run == move.run)
+		std::cout << "Marshal fixed decode :	[OK]" << std::endl;
+	else
+		std::cout << "Marshal fixed decode :	[FAILED]" << std::endl;
+	std::cout << "Marshal short decode :	"
+		<< ((NINA::Marshal<Move, MoveLayout>::decode(ipacket, rmove) < 0) ? "[OK]" : "[FAILED]") << std::endl;
+
+	chat.channel = 7;
+	chat.text = "Hello world!";
+	chat.stamp = -42;
+	opacket.clear();
+	NINA::Marshal<Chat, ChatLayout>::encode(opacket, chat);
+	ipacket.assign(opacket.dump());
+	std::cout << "Marshal variable size :	" << NINA::Marshal<Chat, ChatLayout>::FIXED << " "
+		<< NINA::Marshal<Chat, ChatLayout>::size(chat) << " (should be 0 23) ";
+	if (NINA::Marshal<Chat, ChatLayout>::decode(ipacket, rchat) == 0 && rchat.channel == chat.channel &&
+			rchat.text == chat.text && rchat.stamp == chat.stamp)
+		std::cout << "[OK]" << std::endl;
+	else
+		std::cout << "[FAILED]" << std::endl;
+	// Cut in the last field, then in the string
+	ipacket.assign(opacket.dump().substr(0, opacket.dump().size() - 3));
+	ok = (NINA::Marshal<Chat, ChatLayout>::decode(ipacket, rchat) < 0);
+	ipacket.assign(opacket.dump().substr(0, 8));
+	ok = ok && (NINA::Marshal<Chat, ChatLayout>::decode(ipacket, rchat) < 0);
+	std::cout << "Marshal variable short decode :	" << (ok ? "[OK]" : "[FAILED]") << std::endl;
+
+	// Cut in the varint of the last integer, then feed a varint longer than 64 bits
+	opacket.clear();
+	opacket.setEncoding(NINA::CDR::COMPACT);
+	NINA::Marshal<Move, MoveLayout>::encode(opacket, move);
+	ipacket.setEncoding(NINA::CDR::COMPACT);
+	ipacket.assign(opacket.dump());
+	ok = (NINA::Marshal<Move, MoveLayout>::decode(ipacket, rmove) == 0 && rmove.id == move.id &&
+			rmove.x == move.x && rmove.y == move.y && rmove.run == move.run);
+	ipacket.assign(opacket.dump().substr(0, opacket.dump().size() - 2));
+	ok = ok && (NINA::Marshal<Move, MoveLayout>::decode(ipacket, rmove) < 0);
+	ipacket.assign(std::string(11, '\xFF') + opacket.dump());
+	ok = ok && (NINA::Marshal<Move, MoveLayout>::decode(ipacket, rmove) < 0);
+	std::cout << "Marshal compact short decode :	" << (ok ? "[OK]" : "[FAILED]") << std::endl << std::endl;
+}
+
+void		testCompact()
+{
+	NINA::OutputPacket	opacket("", NINA::CDR::COMPACT);
+	NINA::InputPacket	ipacket("", NINA::CDR::COMPACT);
+	NINA::CDR::ULong	counter = 3;
+	NINA::CDR::Integer	delta = -64;
+	NINA::CDR::Short	sh = 300;
+	NINA::CDR::ULong	big = NINA_UINT64_C(0xFFFFFFFF, 0xFFFFFFFF);
+	NINA::CDR::Long		neg = -static_cast<NINA::CDR::Long> (NINA_UINT64_C(0x7FFFFFFF, 0xFFFFFFFF));
+	NINA::CDR::UInteger	ui = 0x10000000;
+	NINA::CDR::UShort	us = 127;
+
+	opacket << counter << delta << sh << big << neg << ui << us;
+	std::cout << "Compact dump :		";
+	hexDump(opacket.dump());
+	std::cout << "Compact size :		" << std::dec << opacket.dump().size() << " (should be 30)" << std::endl;
+
+	NINA::CDR::ULong	rcounter;
+	NINA::CDR::Integer	rdelta;
+	NINA::CDR::Integer	pdelta;
+	NINA::CDR::Short	rsh;
+	NINA::CDR::ULong	rbig;
+	NINA::CDR::Long		rneg;
+	NINA::CDR::UInteger	rui;
+	NINA::CDR::UShort	rus;
+
+	ipacket.assign(opacket.dump());
+	ipacket >> rcounter;
+	ipacket.peek(pdelta);
+	ipacket >> rdelta >> rsh >> rbig >> rneg >> rui >> rus;
+	if (rcounter == counter && rdelta == delta && pdelta == delta && rsh == sh &&
+			rbig == big && rneg == neg && rui == ui && rus == us)
+		std::cout << "Compact decode :	[OK]" << std::endl << std::endl;
+	else
+		std::cout << "Compact decode :	[FAILED]" << std::endl << std::endl;
+}
+
+void		testGather()
+{
+	NINA::GatherPacket	gpacket(16);
+	NINA::OutputPacket	opacket;
+	NINA::IOContainer	ioc;
+	NINA::CDR::String	blob(64, 'x');
+	NINA::CDR::String	small("small");
+	size_t				total = 0;
+
+	gpacket << static_cast<NINA::CDR::UShort> (1) << small << blob << static_cast<NINA::CDR::Integer> (-1) << blob;
+	opacket << static_cast<NINA::CDR::UShort> (1) << small << blob << static_cast<NINA::CDR::Integer> (-1) << blob;
+	gpacket.fill(ioc);
+	for (size_t i = 0; i < ioc.getSize(); ++i)
+		total += ioc[i].second;
+	std::cout << "Gather segments :	" << std::dec << ioc.getSize() << " " << total << " (should be 4 139) ";
+	std::cout << ((gpacket.dump() == opacket.dump() && ioc[1].first == blob.data()) ? "[OK]" : "[FAILED]");
+	std::cout << std::endl << std::endl;
+}
+
+void		testByteOrder()
+{
+	NINA::OutputPacket	opacket;
+	NINA::InputPacket	ipacket;
+	NINA::CDR::Integer	values[4] = {1, -2, 0x11223344, 0x7FFFFFFF};
+	NINA::CDR::Integer	rvalues[4] = {0, 0, 0, 0};
+	NINA::CDR::UShort	us = 0xAABB;
+	NINA::CDR::UShort	rus = 0;
+	Move				move = {0xAABBCCDD, -2, 300, true};
+	Move				rmove;
+	bool				ok = true;
+
+	opacket.setByteOrder(NINA::CDR::LITTLE_ENDIAN_ORDER);
+	opacket.writeFormat() << us;
+	opacket.writeArray(values, 4);
+	NINA::Marshal<Move, MoveLayout>::encode(opacket, move);
+	std::cout << "Little endian dump :	";
+	hexDump(opacket.dump());
+
+	ipacket.assign(opacket.dump());
+	ok = (ipacket.readFormat() == 0 && ipacket.getByteOrder() == NINA::CDR::LITTLE_ENDIAN_ORDER);
+	ipacket >> rus;
+	ok = ok && (ipacket.readArray(rvalues, 4) == 4) && rus == us;
+	for (size_t i = 0; i < 4; ++i)
+		ok = ok && (rvalues[i] == values[i]);
+	ok = ok && (NINA::Marshal<Move, MoveLayout>::decode(ipacket, rmove) == 0);
+	ok = ok && rmove.id == move.id && rmove.x == move.x && rmove.y == move.y && rmove.run == move.run;
+	std::cout << "Byte order decode :	" << (ok ? "[OK]" : "[FAILED]") << std::endl << std::endl;
+}
+
+void		testChecksum()
+{
+	NINA::PacketFactory<>	pfactory("\r\n", true);
+	NINA::OutputPacket		opacket;
+	std::string				frame;
+
+	std::cout << "CRC32C check value :\t0x" << std::hex << NINA::CRC32C::compute("123456789", 9)
+		<< " (should be 0xE3069283) hardware " << std::boolalpha << NINA::CRC32C::isHardwareAccelerated() << std::endl;
+
+	opacket << NINA::CDR::String("Hello world!");
+	opacket.writeChecksum();
+	frame = opacket.dump();
+	pfactory.pushStream(frame + "\r\n");
+	frame[3] = 'L';
+	pfactory.pushStream(frame + "\r\n");
+	pfactory.pushStream("no trailer\r\n");
+	std::cout << "Checked frames :\t" << std::dec << pfactory.size() << " " << pfactory.getCorruptFrames()
+		<< " " << pfactory.begin()->dump() << " (should be 1 2 Hello world!)" << std::endl;
+
+	// Every byte value shows up in some trailer, none of them may be taken for the delimiter
+	NINA::PacketFactory<>	lines("\n", true);
+	std::ostringstream		stream;
+	bool					ok = true;
+
+	for (int i = 0; i < 2000; ++i) {
+		NINA::OutputPacket	message;
+		std::ostringstream	text;
+
+		text << "message number " << i;
+		message << NINA::CDR::String(text.str());
+		message.writeChecksum();
+		stream << message.dump() << "\n";
+	}
+	lines.pushStream(stream.str());
+	std::cout << "Checksummed frames :\t" << ((lines.size() == 2000 && lines.getCorruptFrames() == 0) ? "[OK]" : "[FAILED]")
+		<< std::endl;
+	try {
+		NINA::PacketFactory<>	digits("0", true);
+
+		ok = false;
+	}
+	catch (std::invalid_argument const&) {
+	}
+	std::cout << "Hexadecimal delimiter rejected :\t" << (ok ? "[OK]" : "[FAILED]") << std::endl << std::endl;
+}
+
 void		testPacket()
 {
 	NINA::InputPacket	ipacket;
@@ -38,7 +258,7 @@ void		testPacket()
 	NINA::CDR::Char		eor = '\0';
 	NINA::CDR::String	test("This is a test");
 	NINA::CDR::Integer	i = 0xAABBCCDD;
-	NINA::CDR::Long		c = 0x5B1122334455665DULL;
+	NINA::CDR::Long		c = NINA_UINT64_C(0x5B112233, 0x4455665D);
 	NINA::CDR::UChar	sh = 1;
 
 	opacket << boolean << hello << eor << test << eor << i << c << sh << sh;
@@ -99,6 +319,12 @@ void		testPacket()
 		std::cout << i->dump() << std::endl;
 	std::cout << std::endl;
 
+	testMarshal();
+	testCompact();
+	testGather();
+	testByteOrder();
+	testChecksum();
+
 #if defined (NINA_WIN32)
 	system("pause");
 #endif // !NINA_WIN32
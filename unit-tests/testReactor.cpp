@@ -13,8 +13,71 @@
 // OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
 #include <iostream>
+#include <vector>
 #include <nina.h>
 
+#if defined (NINA_POSIX)
+# include <sys/resource.h>
+# include <unistd.h>
+#endif // !NINA_POSIX
+
+class Client : public NINA::ServiceHandler<>
+{
+	public:
+		static int		sInitialized;
+		static int		sExpired;
+		static int		sIdle;
+		static Client*	sLast;
+
+	public:
+		virtual int init() {++sInitialized; sLast = this; return 0;};
+		virtual int handleTimer(long) {++sExpired; return 0;};
+		virtual int handleIdle(NINA::NINAHandle) {++sIdle; return 1;};
+};
+
+class Draining : public NINA::ServiceHandler<>
+{
+	public:
+		static int	sClosed;
+
+	public:
+		Draining(bool isBusy) : mIsBusy(isBusy) {};
+		virtual int init() {return 0;};
+		virtual int handleDrain(NINA::NINAHandle) {return mIsBusy ? 0 : -1;};
+		virtual int handleClose(NINA::NINAHandle) {++sClosed; return 0;};
+
+	private:
+		bool	mIsBusy;
+};
+
+class Session : public NINA::DatagramHandler
+{
+	public:
+		static int	sOpened;
+		static int	sDatagrams;
+		static int	sClosed;
+
+	public:
+		virtual ~Session() {++sClosed;};
+		virtual int init() {++sOpened; return 0;};
+		virtual int handleDatagram(char const* data, size_t len)
+		{
+			++sDatagrams;
+			if (std::string(data, len) == "bye")
+				return -1;
+			return getPeer().send(data, len) < 0 ? -1 : 0;
+		};
+};
+
+int Session::sOpened = 0;
+int Session::sDatagrams = 0;
+int Session::sClosed = 0;
+int Draining::sClosed = 0;
+int Client::sInitialized = 0;
+int Client::sExpired = 0;
+int Client::sIdle = 0;
+Client* Client::sLast = 0;
+
 int			timeoutFunction(NINA::Sock& sap)
 {
 	std::cout << "Timeout on handle : " << sap.getHandle() << std::endl;
@@ -50,9 +113,373 @@ void		testReactor()
 		std::cout << "Register handler failed" << std::endl;
 	if (react.handleEvents(0) == -1)
 		std::cout << "Error while handling events" << std::endl;
+
+	{
+		NINA::Reactor<NINA::PollPolicy>	other;
+
+		std::cout << "Running a second reactor ... ";
+		if (other.handleEvents(&NINA::Time::timeNull) == -1 || &NINA::Reactor<NINA::PollPolicy>::getSingleton() != &other)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+		react.handleEvents(&NINA::Time::timeNull);
+	}
+
+	{
+		NINA::Reactor<NINA::PollPolicy>	wheel;
+		Client							idle;
+		Client							active;
+		NINA::Time						tick(0, 5000);
+
+		std::cout << "Reaping idle handlers ... ";
+		wheel.setIdleGranularity(NINA::Time(0, 10000));
+		wheel.trackIdle(&idle, NINA::Time(0, 30000));
+		wheel.trackIdle(&active, NINA::Time(0, 30000));
+		for (int i = 0; i < 20; ++i) {
+			wheel.handleEvents(&tick);
+			active.setLastActivity(wheel.now());
+		}
+		if (Client::sIdle != 1 || wheel.untrackIdle(&idle) != -1 || wheel.untrackIdle(&active) != 0)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+
+	{
+		NINA::Reactor<NINA::PollPolicy>						udp;
+		NINA::DatagramAcceptor<Session, NINA::PollPolicy>	acceptor(&udp);
+		NINA::SockDatagram									first;
+		NINA::SockDatagram									second;
+		NINA::InetAddr										local;
+		NINA::InetAddr										bound;
+		NINA::Time											tick(0, 5000);
+		char												reply[16];
+
+		std::cout << "Demultiplexing datagram peers ... ";
+		local.localQuery("127.0.0.1", 0, IPPROTO_UDP);
+		udp.setIdleGranularity(NINA::Time(0, 10000));
+		acceptor.setIdleTimeout(NINA::Time(0, 30000));
+		acceptor.open(local, AF_INET);
+		acceptor.getSocket().getLocalAddr(bound);
+		first.open(NINA::Addr::sapAny, AF_INET);
+		second.open(NINA::Addr::sapAny, AF_INET);
+		first.enable(NINA::SAP::NON_BLOCK);
+		first.sendToPeer("a", 1, bound);
+		first.sendToPeer("b", 1, bound);
+		second.sendToPeer("c", 1, bound);
+		for (int i = 0; i < 10 && Session::sDatagrams < 3; ++i)
+			udp.handleEvents(&tick);
+		if (acceptor.getSessionCount() != 2 || Session::sOpened != 2 || Session::sDatagrams != 3 ||
+				first.receiveFromPeer(reply, sizeof reply) != 1 || reply[0] != 'a')
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+
+		// A session ends either on request or once it stays idle, the table is never scanned
+		std::cout << "Expiring datagram sessions ... ";
+		second.sendToPeer("bye", 3, bound);
+		for (int i = 0; i < 10 && Session::sDatagrams < 4; ++i)
+			udp.handleEvents(&tick);
+		if (acceptor.getSessionCount() != 1 || Session::sClosed != 1)
+			std::cout << "[FAILED]" << std::endl;
+		else {
+			for (int i = 0; i < 20 && acceptor.getSessionCount() != 0; ++i)
+				udp.handleEvents(&tick);
+			if (acceptor.getSessionCount() != 0 || Session::sClosed != 2)
+				std::cout << "[FAILED]" << std::endl;
+			else
+				std::cout << "[OK]" << std::endl;
+		}
+	}
+
+#if defined (NINA_HAS_EPOLL)
+	{
+		NINA::Reactor<NINA::EpollPolicy>	epoll;
+		NINA::Time							wait(0, 300);
+		NINA::Time							start(0, 0);
+		NINA::Time							elapsed(0, 0);
+
+		// A sub-millisecond wait must neither be truncated to a busy poll nor rounded up to a millisecond
+		std::cout << "Waiting 300us with epoll ... ";
+		start.monotonic();
+		for (int i = 0; i < 5; ++i)
+			epoll.handleEvents(&wait);
+		elapsed.monotonic();
+		elapsed -= start;
+		if (elapsed < wait * 5)
+			std::cout << "[FAILED] " << elapsed.getNanoseconds() << "ns" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+#endif // !NINA_HAS_EPOLL
 	std::cout << std::endl;
 
 #if defined (NINA_WIN32)
 	system("pause");
 #endif // !NINA_WIN32
 }
+
+void		testConnector()
+{
+	NINA::Reactor<NINA::PollPolicy>									react;
+	NINA::Connector<Client, NINA::SockConnector, NINA::PollPolicy, false>	connector(&react);
+	NINA::SockAcceptor												acceptor;
+	NINA::InetAddr													local;
+	NINA::InetAddr													bound;
+	NINA::Time														wait(0, 100000);
+	NINA::Time														attempt(1, 0);
+	Client															timed;
+	long															timerId;
+
+	std::cout << "Expiring timers ... ";
+	react.scheduleTimer(&timed, NINA::Time(0, 10000));
+	timerId = react.scheduleTimer(&timed, NINA::Time(0, 20000));
+	react.cancelTimer(timerId);
+	for (int i = 0; i < 10 && Client::sExpired == 0; ++i)
+		react.handleEvents(&wait);
+	react.handleEvents(&wait);
+	if (Client::sExpired != 1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+
+	local.localQuery("127.0.0.1", 0, IPPROTO_TCP);
+	acceptor.open(local, AF_INET, IPPROTO_TCP, true);
+	acceptor.getLocalAddr(bound);
+	std::cout << "Connecting asynchronously ... ";
+	if (connector.connect(bound, &attempt) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else {
+		for (int i = 0; i < 10 && Client::sInitialized == 0; ++i)
+			react.handleEvents(&wait);
+		if (Client::sInitialized != 1 || connector.getPendingCount() != 0)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+	acceptor.close();
+	std::cout << "Connecting to a closed port ... ";
+	if (connector.connect(bound, &attempt) == 0)
+		for (int i = 0; i < 10 && connector.getPendingCount() != 0; ++i)
+			react.handleEvents(&wait);
+	if (Client::sInitialized != 1 || connector.getPendingCount() != 0)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+
+	NINA::InetAddrList	addrs;
+	NINA::InetAddr		live;
+	Client*				raced = new Client;
+
+	// The closed port is tried first, its failure must start the next attempt without waiting for the delay
+	acceptor.open(local, AF_INET, IPPROTO_TCP, true);
+	acceptor.getLocalAddr(live);
+	addrs.remoteQuery("127.0.0.1", live.getPortByNumber(), IPPROTO_TCP);
+	addrs.insert(addrs.begin(), bound);
+	connector.setAttemptDelay(NINA::Time(10, 0));
+	std::cout << "Racing several addresses ... ";
+	if (addrs.size() != 2 || connector.connect(addrs, &attempt, raced) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else {
+		for (int i = 0; i < 10 && Client::sInitialized == 1; ++i)
+			react.handleEvents(&wait);
+		if (Client::sInitialized != 2 || connector.getPendingCount() != 0 ||
+				raced->getRemoteAddr() != live || raced->getHandle() == NINA_INVALID_HANDLE)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+	raced->destroy();
+	acceptor.close();
+
+	NINA::RecycleAllocator<Client>	allocator(1);
+	Client*							first;
+	Client*							second;
+
+	std::cout << "Recycling service handlers ... ";
+	first = allocator.allocate();
+	second = allocator.allocate();
+	first->destroy();
+	second->destroy();
+	if (allocator.getFreeCount() != 1 || allocator.allocate() != first || allocator.getReuses() != 1
+			|| allocator.getAllocations() != 3)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	first->destroy();
+
+	std::cout << "Destroying a handler outliving its allocator ... ";
+	{
+		NINA::RecycleAllocator<Client>	scoped;
+
+		first = scoped.allocate();
+		second = scoped.allocate();
+		second->destroy();
+	}
+	first->destroy();
+	std::cout << "[OK]" << std::endl;
+	std::cout << std::endl;
+}
+
+void		testPool()
+{
+	NINA::Reactor<NINA::PollPolicy>			react;
+	NINA::ConnectionPool<NINA::PollPolicy>	pool(&react, 2, 4);
+	NINA::SockAcceptor						acceptor;
+	NINA::SockStream						stream;
+	NINA::SockStream						peer;
+	NINA::InetAddr							local;
+	NINA::InetAddr							bound;
+	NINA::Time								wait(0, 50000);
+	char									c;
+
+	local.localQuery("127.0.0.1", 0, IPPROTO_TCP);
+	acceptor.open(local, AF_INET, IPPROTO_TCP, true);
+	acceptor.getLocalAddr(bound);
+	std::cout << "Warming the connection pool ... ";
+	pool.warm(bound);
+	for (int i = 0; i < 10 && pool.getIdleCount(bound) < 2; ++i)
+		react.handleEvents(&wait);
+	if (pool.getIdleCount(bound) != 2)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Acquiring and releasing a connection ... ";
+	if (pool.acquire(bound, stream) == -1 || stream.getHandle() == NINA_INVALID_HANDLE ||
+			pool.release(bound, stream) == -1 || stream.getHandle() != NINA_INVALID_HANDLE)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Evicting the connections closed by the backend ... ";
+	acceptor.enable(NINA::SAP::NON_BLOCK);
+	while (acceptor.accept(peer) == 0)
+		peer.close();
+	for (int i = 0; i < 3; ++i)
+		react.handleEvents(&wait);
+	if (pool.acquire(bound, stream) == -1 || stream.receive(&c, 1) != -1 || (errno != EAGAIN && errno != EWOULDBLOCK))
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	stream.close();
+	std::cout << std::endl;
+}
+
+void		testOverload()
+{
+	NINA::Reactor<NINA::PollPolicy>									react;
+	NINA::Acceptor<Client, NINA::SockAcceptor, NINA::PollPolicy, false>	acceptor(&react);
+	NINA::SockConnector												connector;
+	NINA::SockStream												client;
+	NINA::SockStream												pending;
+	NINA::InetAddr													local;
+	NINA::InetAddr													bound;
+	NINA::Time														wait(0, 20000);
+	Client															extra;
+	int																initialized;
+
+	local.localQuery("127.0.0.1", 0, IPPROTO_TCP);
+	acceptor.setMaxConnections(1);
+	acceptor.setOverloadCheck(NINA::Time(0, 10000));
+	acceptor.open(local, true, AF_INET, IPPROTO_TCP, true);
+	acceptor.getLocalAddr(bound);
+	client.open(NINA::Addr::sapAny, AF_INET);
+	connector.connect(client, bound);
+	initialized = Client::sInitialized;
+	std::cout << "Counting the live connections only ... ";
+	// Other handles of the reactor are not connections of the acceptor
+	react.registerHandler(client.getHandle(), &extra, NINA::Events::READ);
+	react.handleEvents(&wait);
+	react.removeHandler(client.getHandle(), NINA::Events::READ);
+	if (acceptor.getConnectionCount() != 1 || Client::sInitialized != initialized + 1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Suspending an overloaded acceptor ... ";
+	pending.open(NINA::Addr::sapAny, AF_INET);
+	connector.connect(pending, bound);
+	// The acceptor holds exactly its maximum, it must stay suspended across several checks
+	for (int i = 0; i < 5; ++i)
+		react.handleEvents(&wait);
+	if (acceptor.isOverloaded() == false || acceptor.getOverloadCount() != 1 || Client::sInitialized != initialized + 1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Resuming once the load decreased ... ";
+	Client::sLast->destroy();
+	for (int i = 0; i < 10 && Client::sInitialized == initialized + 1; ++i)
+		react.handleEvents(&wait);
+	if (Client::sInitialized != initialized + 2 || acceptor.getConnectionCount() != 1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	Client::sLast->destroy();
+	client.close();
+	pending.close();
+	acceptor.setMaxConnections(0);
+	for (int i = 0; i < 10 && acceptor.isOverloaded() == true; ++i)
+		react.handleEvents(&wait);
+
+#if defined (NINA_POSIX)
+	std::vector<int>	fillers;
+	rlimit				saved;
+	rlimit				limit;
+	int					fd;
+
+	std::cout << "Rejecting connections once the handles are exhausted ... ";
+	client.open(NINA::Addr::sapAny, AF_INET);
+	connector.connect(client, bound);
+	// Fill every handle below the limit, thus the reserved one is the only way to accept
+	while ((fd = ::dup(0)) != -1 && fd <= client.getHandle())
+		fillers.push_back(fd);
+	if (fd != -1)
+		::close(fd);
+	::getrlimit(RLIMIT_NOFILE, &saved);
+	limit = saved;
+	limit.rlim_cur = fd;
+	::setrlimit(RLIMIT_NOFILE, &limit);
+	react.handleEvents(&wait);
+	::setrlimit(RLIMIT_NOFILE, &saved);
+	if (acceptor.getRejectedCount() != 1 || acceptor.isOverloaded() == false)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	for (size_t i = 0; i < fillers.size(); ++i)
+		::close(fillers[i]);
+	client.close();
+#endif // !NINA_POSIX
+	std::cout << std::endl;
+}
+
+void		testDrain()
+{
+	NINA::Reactor<NINA::PollPolicy>									react;
+	NINA::Acceptor<Client, NINA::SockAcceptor, NINA::PollPolicy, false>	acceptor(&react);
+	NINA::InetAddr													local;
+	NINA::SockDatagram												busySock;
+	NINA::SockDatagram												idleSock;
+	Draining														busy(true);
+	Draining														idle(false);
+
+	local.localQuery("127.0.0.1", 0, IPPROTO_TCP);
+	acceptor.open(local, true, AF_INET, IPPROTO_TCP, true);
+	busySock.open(NINA::Addr::sapAny, AF_INET);
+	idleSock.open(NINA::Addr::sapAny, AF_INET);
+	react.registerHandler(busySock.getHandle(), &busy, NINA::Events::READ);
+	react.registerHandler(idleSock.getHandle(), &idle, NINA::Events::READ);
+	std::cout << "Starting a drain ... ";
+	if (react.drain(NINA::Time(0, 50000)) == -1 || react.getHandleCount() != 1 || Draining::sClosed != 1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Closing the remaining handlers at the deadline ... ";
+	react.handleEventsLoop();
+	if (react.isDraining() == true || react.getHandleCount() != 0 || Draining::sClosed != 2
+			|| react.getDrainReport().notified != 3 || react.getDrainReport().closed != 1
+			|| react.getDrainReport().forced != 1 || react.getDrainReport().elapsed < NINA::Time(0, 50000))
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	busySock.close();
+	idleSock.close();
+	std::cout << std::endl;
+}
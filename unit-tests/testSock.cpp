@@ -13,8 +13,32 @@
 // OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
 #include <iostream>
+#include <sstream>
 #include <nina.h>
 
+#if defined (NINA_POSIX)
+# include <fcntl.h>
+# include <net/if.h>
+# include <netinet/tcp.h>
+# include <unistd.h>
+#endif // !NINA_POSIX
+
+class Feeds : public NINA::MulticastReceiver<NINA::PollPolicy>
+{
+	public:
+		Feeds(NINA::Reactor<NINA::PollPolicy>* reactor) : NINA::MulticastReceiver<NINA::PollPolicy>(reactor) {};
+		virtual int handleDatagram(NINA::InetAddr const& group, char const* data, size_t len)
+		{
+			NINA::InetAddr	addr(group);
+
+			mReceived.push_back(addr.getHostAddr() + " " + std::string(data, len));
+			return 0;
+		};
+
+	public:
+		std::vector<std::string>	mReceived;
+};
+
 void		testSock()
 {
 	NINA::SockDatagram	sock;
@@ -50,9 +74,341 @@ void		testSock()
 		std::cout << "[FAILED]" << std::endl;
 	else
 		std::cout << "[OK]" << std::endl;
+
+	NINA::InetAddr	group;
+	NINA::InetAddr	other;
+	NINA::InetAddr	local;
+
+	group.remoteQuery("239.1.2.3", 0, IPPROTO_UDP);
+	other.remoteQuery("239.1.2.4", 0, IPPROTO_UDP);
+	local.remoteQuery("127.0.0.1", 0, IPPROTO_UDP);
+	std::cout << "Recognizing IPv4 multicast and loopback addresses ... ";
+	if (group.isMulticast() == false || group.isLoopback() == true || local.isMulticast() == true || local.isLoopback() == false)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+
+#if defined (NINA_LINUX)
+	{
+		NINA::Reactor<NINA::PollPolicy>	react;
+		Feeds							feeds(&react);
+		NINA::SockDatagram				sender;
+		NINA::Time						wait(0, 10000);
+		unsigned int					lo = ::if_nametoindex("lo");
+
+		// Both groups share a port, thus a socket: they are told apart by their destination
+		sock.open(local, AF_INET);
+		sock.getLocalAddr(local);
+		sock.close();
+		group.setPort(local.getPortByNumber());
+		other.setPort(local.getPortByNumber());
+		sender.open(NINA::Addr::sapAny, AF_INET);
+		std::cout << "Receiving multicast feeds on the loopback ... ";
+		if (feeds.join(group, lo) == -1 || feeds.join(other, lo) == -1 || feeds.getSocketCount() != 1 ||
+				sender.setMulticastInterface(lo) == -1 || sender.setMulticastLoop(true) == -1 || sender.setMulticastHops(1) == -1)
+			std::cout << "[FAILED] " << NINA::Error::getLastError() << std::endl;
+		else {
+			sender.sendToPeer("x", 1, group);
+			sender.sendToPeer("y", 1, other);
+			for (int i = 0; i < 10 && feeds.mReceived.size() < 2; ++i)
+				react.handleEvents(&wait);
+			if (feeds.mReceived.size() != 2 || feeds.mReceived[0] != "239.1.2.3 x" || feeds.mReceived[1] != "239.1.2.4 y")
+				std::cout << "[FAILED]" << std::endl;
+			else
+				std::cout << "[OK]" << std::endl;
+		}
+		std::cout << "Leaving a multicast group ... ";
+		feeds.mReceived.clear();
+		if (feeds.leave(other) == -1 || feeds.leave(other) != -1 || feeds.getGroupCount() != 1)
+			std::cout << "[FAILED]" << std::endl;
+		else {
+			sender.sendToPeer("z", 1, other);
+			sender.sendToPeer("w", 1, group);
+			for (int i = 0; i < 10 && feeds.mReceived.empty(); ++i)
+				react.handleEvents(&wait);
+			react.handleEvents(&wait);
+			if (feeds.mReceived.size() != 1 || feeds.mReceived[0] != "239.1.2.3 w")
+				std::cout << "[FAILED]" << std::endl;
+			else
+				std::cout << "[OK]" << std::endl;
+		}
+# if defined (NINA_HAS_TIMESTAMPING)
+		std::cout << "Recording the receive latency of the feeds ... ";
+		if (react.getReceiveLatency().getCount() != 3 || react.getReceiveLatency().getMax() > NINA::Time(1, 0))
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+# endif // !NINA_HAS_TIMESTAMPING
+	}
+#endif // !NINA_LINUX
+#if defined (NINA_HAS_TIMESTAMPING)
+	{
+		NINA::SockDatagram					receiver;
+		NINA::SockDatagram					sender;
+		NINA::InetAddr						loop;
+		NINA::Time							stamp(0, 0);
+		NINA::Time							current(0, 0);
+		std::vector<NINA::SendTimestamp>	sent;
+
+		loop.remoteQuery("127.0.0.1", 0, IPPROTO_UDP);
+		receiver.open(loop, AF_INET);
+		receiver.getLocalAddr(loop);
+		sender.open(NINA::Addr::sapAny, AF_INET);
+		std::cout << "Timestamping the datagrams received ... ";
+		if (receiver.setTimestamping(NINA::SockIO::RX_TIMESTAMP) == -1 || sender.sendToPeer("t", 1, loop) == -1 ||
+				receiver.receive(buf, sizeof buf, stamp) != 1 || current.timestamp() == -1 ||
+				stamp == NINA::Time::timeNull || current < stamp || current - stamp > NINA::Time(1, 0))
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+		std::cout << "Collecting the send timestamps ... ";
+		if (sender.setTimestamping(NINA::SockIO::TX_TIMESTAMP) == -1 ||
+				sender.sendToPeer("a", 1, loop) == -1 || sender.sendToPeer("b", 1, loop) == -1)
+			std::cout << "[FAILED] " << NINA::Error::getLastError() << std::endl;
+		else {
+			for (int i = 0; i < 10 && sent.size() < 2; ++i) {
+				if (sender.receiveSendTimestamps(sent) == 0)
+					::usleep(1000);
+			}
+			if (sent.size() != 2 || sent[0].type != NINA::SendTimestamp::SENT || sent[0].id != 0 || sent[1].id != 1 ||
+					sent[1].stamp < stamp)
+				std::cout << "[FAILED]" << std::endl;
+			else
+				std::cout << "[OK]" << std::endl;
+		}
+	}
+#endif // !NINA_HAS_TIMESTAMPING
 	std::cout << std::endl;
 
 #if defined (NINA_WIN32)
 	system("pause");
 #endif // !NINA_WIN32
 }
+
+void		testAccept()
+{
+	NINA::SockAcceptor	acceptor;
+	NINA::SockConnector	connector;
+	NINA::SockStream	client;
+	NINA::SockStream	peer;
+	NINA::InetAddr		local;
+	NINA::InetAddr		bound;
+
+	local.localQuery("127.0.0.1", 0, IPPROTO_TCP);
+	std::cout << "Opening acceptor on loopback ... ";
+	if (acceptor.open(local, AF_INET, IPPROTO_TCP, true) == -1 || acceptor.getLocalAddr(bound) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Connecting to the acceptor ... ";
+	if (client.open(NINA::Addr::sapAny, AF_INET) == -1 || connector.connect(client, bound) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Accepting with non block and close on exec flags ... ";
+	if (acceptor.accept(peer, 0, NINA::SAP::NON_BLOCK | NINA::SAP::CLOSE_ON_EXEC) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+#if defined (NINA_POSIX)
+	std::cout << "Checking the accepted handle options ... ";
+	if ((::fcntl(peer.getHandle(), F_GETFL, 0) & O_NONBLOCK) == 0
+			|| (::fcntl(peer.getHandle(), F_GETFD, 0) & FD_CLOEXEC) == 0)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+#endif // !NINA_POSIX
+	std::cout << "Accepting on a drained non blocking acceptor ... ";
+	acceptor.enable(NINA::SAP::NON_BLOCK);
+	if (acceptor.accept(peer) == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		std::cout << "[OK]" << std::endl;
+	else
+		std::cout << "[FAILED]" << std::endl;
+	peer.close();
+	client.close();
+	acceptor.close();
+
+	NINA::SocketProfile	profile = NINA::SocketProfile::lowLatency();
+	int					noDelay = 0;
+	int					noDelayLen = sizeof noDelay;
+
+	std::cout << "Listening with a low latency profile ... ";
+	if (acceptor.open(local, AF_INET, IPPROTO_TCP, true, SOMAXCONN, false, &profile) == -1
+			|| acceptor.getLocalAddr(bound) == -1
+			|| acceptor.getOption(IPPROTO_TCP, TCP_NODELAY, &noDelay, &noDelayLen) == -1 || noDelay == 0)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Connecting and accepting with the profile ... ";
+	noDelay = 0;
+	if (client.open(NINA::Addr::sapAny, AF_INET) == -1 || profile.applyConnector(client) == -1
+			|| connector.connect(client, bound) == -1 || acceptor.accept(peer) == -1
+			|| profile.applyAccepted(peer) == -1
+			|| peer.getOption(IPPROTO_TCP, TCP_NODELAY, &noDelay, &noDelayLen) == -1 || noDelay == 0)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	peer.close();
+	client.close();
+	acceptor.close();
+
+#if defined (NINA_HAS_REUSEPORT)
+	NINA::SockAcceptor	shards[2];
+
+	std::cout << "Sharding a listening address with reuse port ... ";
+	if (shards[0].open(local, AF_INET, IPPROTO_TCP, true, SOMAXCONN, true) == -1
+			|| shards[0].getLocalAddr(bound) == -1
+			|| shards[1].open(bound, AF_INET, IPPROTO_TCP, true, SOMAXCONN, true) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Steering the shards by CPU ... ";
+	if (shards[0].steerByCPU(2) == -1 && errno != ENOTSUP)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+#endif // !NINA_HAS_REUSEPORT
+	std::cout << std::endl;
+}
+
+#if defined (NINA_POSIX)
+class UnixPeer : public NINA::ServiceHandler<NINA::UnixStream>
+{
+	public:
+		static int	sInitialized;
+
+	public:
+		virtual int init() {++sInitialized; return 0;};
+};
+
+class AdoptedPeer : public NINA::ServiceHandler<>
+{
+	public:
+		static int	sInitialized;
+
+	public:
+		virtual int init() {++sInitialized; return 0;};
+};
+
+int UnixPeer::sInitialized = 0;
+int AdoptedPeer::sInitialized = 0;
+
+void		testUnix()
+{
+	NINA::UnixAcceptor	acceptor;
+	NINA::SockConnector	connector;
+	NINA::UnixStream	client;
+	NINA::UnixStream	peer;
+	NINA::UnixAddr		bound;
+	NINA::UnixAddr		remote;
+	std::ostringstream	name;
+	std::string			path;
+	char				buf[4];
+
+	name << "nina-unit-" << ::getpid();
+	path = "/tmp/" + name.str() + ".sock";
+
+	::unlink(path.c_str());
+	std::cout << "Accepting on a unix domain path ... ";
+	if (acceptor.open(NINA::UnixAddr(path)) == -1 || acceptor.getLocalAddr(bound) == -1
+			|| bound.getPath() != path || bound.isAbstract() == true
+			|| client.open(NINA::Addr::sapAny) == -1 || connector.connect(client, bound) == -1
+			|| acceptor.accept(peer, &remote) == -1 || remote.isUnnamed() == false
+			|| client.send("ping", 4) != 4 || peer.exactReceive(buf, 4) != 4 || std::string(buf, 4) != "ping")
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	peer.close();
+	client.close();
+	std::cout << "Removing the unix domain path ... ";
+	if (acceptor.remove() == -1 || ::access(path.c_str(), F_OK) == 0)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+
+#if defined (NINA_LINUX)
+	NINA::UnixAddr	abstract(name.str(), true);
+
+	std::cout << "Accepting on an abstract unix domain name ... ";
+	if (acceptor.open(abstract) == -1 || acceptor.getLocalAddr(bound) == -1 || bound != abstract
+			|| bound.isAbstract() == false || client.open(NINA::Addr::sapAny) == -1
+			|| connector.connect(client, abstract) == -1 || acceptor.accept(peer) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	peer.close();
+	client.close();
+	acceptor.close();
+#endif // !NINA_LINUX
+
+	NINA::UnixDatagram	first;
+	NINA::UnixDatagram	second;
+
+	std::cout << "Exchanging datagrams over a unix socket pair ... ";
+	if (NINA::UnixDatagram::pair(first, second) == -1 || first.send("pong", 4) != 4
+			|| second.receive(buf, sizeof buf) != 4 || std::string(buf, 4) != "pong")
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+
+	NINA::Reactor<NINA::PollPolicy>												react;
+	NINA::Acceptor<UnixPeer, NINA::UnixAcceptor, NINA::PollPolicy, false>			server(&react);
+	NINA::Connector<UnixPeer, NINA::SockConnector, NINA::PollPolicy, false>	connecting(&react);
+	NINA::Time																	wait(0, 20000);
+
+	::unlink(path.c_str());
+	std::cout << "Connecting service handlers over a unix domain socket ... ";
+	if (server.open(NINA::UnixAddr(path)) == -1 || connecting.connect(NINA::UnixAddr(path)) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else {
+		for (int i = 0; i < 10 && UnixPeer::sInitialized < 2; ++i)
+			react.handleEvents(&wait);
+		if (UnixPeer::sInitialized != 2)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+	::unlink(path.c_str());
+
+	NINA::UnixStream												previous;
+	NINA::UnixStream												next;
+	NINA::SockAcceptor												listener;
+	NINA::Acceptor<AdoptedPeer, NINA::SockAcceptor, NINA::PollPolicy, false>	adopting(&react);
+	NINA::SockStream												tcpClient;
+	NINA::InetAddr													local;
+	NINA::InetAddr													listening;
+	std::vector<NINA::NINAHandle>									handles;
+	std::string														state;
+
+	// The previous process hands its listening socket over then closes its copy
+	local.localQuery("127.0.0.1", 0, IPPROTO_TCP);
+	state.reserve(16);
+	std::cout << "Handing a listening socket over a unix socket ... ";
+	if (NINA::UnixStream::pair(previous, next) == -1 || listener.open(local, AF_INET, IPPROTO_TCP, true) == -1
+			|| listener.getLocalAddr(listening) == -1
+			|| previous.sendHandles(std::vector<NINA::NINAHandle>(1, listener.getHandle()), "http") != 4
+			|| next.receiveHandles(handles, state) != 4 || handles.size() != 1 || state != "http"
+			|| listener.close() == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << "Adopting the listening socket ... ";
+	if (handles.size() != 1 || adopting.adopt(handles[0], true) == -1
+			|| tcpClient.open(NINA::Addr::sapAny, AF_INET) == -1 || connector.connect(tcpClient, listening) == -1)
+		std::cout << "[FAILED]" << std::endl;
+	else {
+		for (int i = 0; i < 10 && AdoptedPeer::sInitialized == 0; ++i)
+			react.handleEvents(&wait);
+		if (AdoptedPeer::sInitialized != 1)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+	std::cout << "Refusing to adopt a socket which does not listen ... ";
+	if (listener.adopt(tcpClient.getHandle()) != -1 || listener.getHandle() != NINA_INVALID_HANDLE)
+		std::cout << "[FAILED]" << std::endl;
+	else
+		std::cout << "[OK]" << std::endl;
+	std::cout << std::endl;
+}
+#endif // !NINA_POSIX
@@ -76,6 +76,74 @@ void		testTime()
 		std::cout << "Current timestamp = " << tm1.getSeconds() << ":" << tm1.getUSeconds()<< std::endl;
 
 		std::cout << std::endl;
+	{
+		NINA::Time	tm1 = NINA::Time::fromNanoseconds(1500000250);
+		NINA::Time	tm2(0, 500000);
+
+		std::cout << "Checking nanosecond arithmetic ... ";
+		tm1 -= tm2;
+		if (tm1.getNanoseconds() == 1000000250 && tm1.getSeconds() == 1 && tm1.getUSeconds() == 0 &&
+				tm1 > NINA::Time(1, 0) && tm1 - NINA::Time::fromNanoseconds(250) == NINA::Time(1, 0))
+			std::cout << "[OK]" << std::endl;
+		else
+			std::cout << "[FAILED]" << std::endl;
+	}
+	{
+		NINA::Time	start(0, 0);
+		NINA::Time	end(0, 0);
+
+		std::cout << "Reading the monotonic clock ... ";
+		if (start.monotonic() == 0 && end.monotonic(true) == 0 && end.monotonic() == 0 && start <= end)
+			std::cout << "[OK]" << std::endl;
+		else
+			std::cout << "[FAILED]" << std::endl;
+	}
+	{
+		NINA::TSCClock	clock;
+		uint64_t		start = clock.read();
+		NINA::Time		pause(0, 20000);
+		uint64_t		nsec;
+
+		std::cout << "Calibrating the TSC clock (" << (NINA::TSCClock::isSupported() ? "invariant" : "monotonic fallback")
+			<< ", " << static_cast<uint64_t> (clock.getFrequency() / 1e6) << " MHz) ... ";
+#if defined (NINA_POSIX)
+		::usleep(static_cast<useconds_t> (pause.getUSeconds()));
+#else
+		::Sleep(static_cast<DWORD> (pause.getUSeconds() / NINA::Time::MSEC_IN_USEC));
+#endif // !NINA_POSIX
+		nsec = clock.toNanoseconds(clock.read() - start);
+		if (nsec >= 15000000 && nsec < 1000000000 && clock.toTime(clock.read() - start) >= NINA::Time(0, 15000))
+			std::cout << "[OK]" << std::endl;
+		else
+			std::cout << "[FAILED] " << nsec << "ns" << std::endl;
+	}
+	{
+		NINA::LatencyHistogram	histogram;
+		NINA::LatencyHistogram	other;
+
+		// 90 latencies of 1.5us and 10 of 3ms
+		for (int i = 0; i < 90; ++i)
+			histogram.record(NINA::Time::fromNanoseconds(1500));
+		for (int i = 0; i < 10; ++i)
+			other.record(NINA::Time(0, 3000));
+		other.record(-1);
+		histogram.merge(other);
+		std::cout << "Computing latency percentiles ... ";
+		if (histogram.getCount() != 101 || histogram.getBucket(0) != 1 || histogram.getBucket(11) != 90 ||
+				histogram.getPercentile(0.5) != NINA::Time::fromNanoseconds(2048) ||
+				histogram.getPercentile(0.99) != NINA::Time(0, 3000) || histogram.getMin() != NINA::Time::timeNull ||
+				histogram.getMax() != NINA::Time(0, 3000))
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+		histogram.reset();
+		std::cout << "Resetting a latency histogram ... ";
+		if (histogram.getCount() != 0 || histogram.getPercentile(0.99) != NINA::Time::timeNull)
+			std::cout << "[FAILED]" << std::endl;
+		else
+			std::cout << "[OK]" << std::endl;
+	}
+		std::cout << std::endl;
 
 #if defined (NINA_WIN32)
 	system("pause");